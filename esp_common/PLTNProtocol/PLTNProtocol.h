@@ -0,0 +1,252 @@
+/*
+ * PLTNProtocol.h - Shared binary protocol codec for PLTN Simulator ESP sketches
+ *
+ * Used by both esp_utama_uart (ESP-BC) and esp_visualizer_uart (ESP-E).
+ * Header-only, no Arduino dependencies - also compiles with host g++ for
+ * off-device testing.
+ *
+ * Provides:
+ * - Protocol framing constants (STX/ETX/ACK/NACK, command bytes)
+ * - CRC-8/MAXIM with a constexpr-generated 256-entry lookup table
+ *   (one table lookup per byte instead of 8 shift/xor iterations)
+ * - Packed payload structs matching the wire format exactly, so frames
+ *   are encoded with a single memcpy and decoded as zero-copy views
+ *   into the RX buffer (no per-field shift/memcpy churn)
+ *
+ * Wire format: [STX][CMD][LEN][PAYLOAD...][CRC8][ETX]
+ * CRC8 is calculated over CMD + LEN + PAYLOAD.
+ * All multi-byte fields are little-endian (native on ESP32 and RasPi).
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace pltn {
+
+// ============================================
+// Protocol Constants
+// ============================================
+constexpr uint8_t STX = 0x02;        // Start of Text
+constexpr uint8_t ETX = 0x03;        // End of Text
+constexpr uint8_t ACK = 0x06;        // Acknowledge
+constexpr uint8_t NACK = 0x15;       // Negative Acknowledge
+constexpr uint8_t CMD_PING = 0x50;      // 'P' - Ping command
+constexpr uint8_t CMD_STREAM = 0x53;    // 'S' - Stream control (ESP-BC only)
+constexpr uint8_t CMD_UPDATE = 0x55;    // 'U' - Update command
+constexpr uint8_t CMD_KEEPALIVE = 0x4B; // 'K' - No-change poll (delta protocol, ESP-BC only)
+constexpr uint8_t CMD_SET_BAUD = 0x42;  // 'B' - Switch link baud rate
+constexpr uint8_t CMD_STATS = 0x54;     // 'T' - Read performance counters
+
+// Baud negotiation: ping at the default rate, switch both ends with
+// CMD_SET_BAUD, revert automatically if the new link is never confirmed
+constexpr uint32_t BAUD_DEFAULT = 115200;
+constexpr uint32_t BAUD_HIGH = 921600;
+constexpr uint32_t BAUD_CONFIRM_TIMEOUT_MS = 3000;
+
+inline bool baud_allowed(uint32_t baud) {
+  return baud == 115200 || baud == 230400 || baud == 460800 || baud == 921600;
+}
+
+// Frame overhead: STX + CMD + LEN + CRC + ETX
+constexpr size_t FRAME_OVERHEAD = 5;
+
+// ============================================
+// CRC-8/MAXIM (poly 0x31, init 0x00)
+// ============================================
+
+// 256-entry lookup table generated at compile time
+struct Crc8Table {
+  uint8_t entry[256];
+
+  constexpr Crc8Table() : entry() {
+    for (int i = 0; i < 256; i++) {
+      uint8_t crc = (uint8_t)i;
+      for (int bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+      }
+      entry[i] = crc;
+    }
+  }
+};
+
+inline constexpr Crc8Table CRC8_TABLE{};
+
+// One table lookup per byte (replaces the 8-iterations-per-byte bit loop)
+inline uint8_t crc8_maxim(const uint8_t* data, size_t len) {
+  uint8_t crc = 0x00;
+  for (size_t i = 0; i < len; i++) {
+    crc = CRC8_TABLE.entry[crc ^ data[i]];
+  }
+  return crc;
+}
+
+// ============================================
+// Packed Payload Structs (wire format)
+// ============================================
+
+// RasPi -> ESP-BC update command (10 bytes)
+struct __attribute__((packed)) EspBcCommand {
+  uint8_t rod_safety;       // Safety rod target (0-100%)
+  uint8_t rod_shim;         // Shim rod target (0-100%)
+  uint8_t rod_regulating;   // Regulating rod target (0-100%)
+  uint8_t pump_primary;     // 0=OFF, 1=STARTING, 2=ON, 3=SHUTTING_DOWN
+  uint8_t pump_secondary;
+  uint8_t pump_tertiary;
+  uint8_t humid_ct1;        // Cooling Tower humidifiers (0/1)
+  uint8_t humid_ct2;
+  uint8_t humid_ct3;
+  uint8_t humid_ct4;
+};
+static_assert(sizeof(EspBcCommand) == 10, "EspBcCommand must be 10 bytes");
+
+// ESP-BC -> RasPi telemetry (23 bytes)
+struct __attribute__((packed)) EspBcTelemetry {
+  uint8_t rod_safety;       // Actual rod positions (0-100%)
+  uint8_t rod_shim;
+  uint8_t rod_regulating;
+  float thermal_kw;         // Thermal power (float32)
+  uint16_t power_level;     // Turbine power x100 (0-10000 for 0.00-100.00%)
+  uint8_t state;            // TurbineState enum
+  uint16_t turbine_speed;   // x100
+  uint16_t pump_primary;    // Pump actual speeds x100
+  uint16_t pump_secondary;
+  uint16_t pump_tertiary;
+  uint8_t humid_ct1;        // Humidifier status (0/1)
+  uint8_t humid_ct2;
+  uint8_t humid_ct3;
+  uint8_t humid_ct4;
+  uint8_t cmd_generation;   // Count of update commands applied (mod 256),
+                            // echoed back for the delta protocol
+};
+static_assert(sizeof(EspBcTelemetry) == 23, "EspBcTelemetry must be 23 bytes");
+
+// RasPi -> ESP-E update command (7 bytes)
+struct __attribute__((packed)) EspECommand {
+  float thermal_kw;         // Thermal power (float32)
+  uint8_t pump_primary;     // Pump status (0-3)
+  uint8_t pump_secondary;
+  uint8_t pump_tertiary;
+};
+static_assert(sizeof(EspECommand) == 7, "EspECommand must be 7 bytes");
+
+// ESP-E -> RasPi response (8 bytes)
+struct __attribute__((packed)) EspEResponse {
+  float power_mwe;          // Electrical power (float32)
+  uint8_t pwm;              // Current LED PWM (0-255)
+  uint8_t pump_primary;     // Pump status echo (0-3)
+  uint8_t pump_secondary;
+  uint8_t pump_tertiary;
+};
+static_assert(sizeof(EspEResponse) == 8, "EspEResponse must be 8 bytes");
+
+// ESP-BC stream control payload (2 bytes)
+struct __attribute__((packed)) StreamCommand {
+  uint16_t interval_ms;     // Push interval (0 = stop streaming)
+};
+static_assert(sizeof(StreamCommand) == 2, "StreamCommand must be 2 bytes");
+
+// RasPi -> ESP-BC keepalive (1 byte). Sent instead of a full update when
+// the command state is unchanged; carries the generation echoed in the
+// last telemetry frame. A mismatch (e.g. ESP rebooted) gets a NACK,
+// prompting the Pi to resend the full command.
+struct __attribute__((packed)) KeepaliveCommand {
+  uint8_t cmd_generation;   // Last generation the sender saw acknowledged
+};
+static_assert(sizeof(KeepaliveCommand) == 1, "KeepaliveCommand must be 1 byte");
+
+// ESP -> RasPi performance counters (32 bytes), reply to CMD_STATS.
+// The loop period window (min/max/mean) resets on every read so each
+// report covers the interval since the previous CMD_STATS; the event
+// counters are cumulative since boot (the Pi side computes deltas).
+// actuator_updates counts servo writes on ESP-BC, LED fade starts on
+// ESP-E.
+struct __attribute__((packed)) EspStats {
+  uint32_t loop_period_min_us;  // Main/control loop period, esp_timer based
+  uint32_t loop_period_max_us;
+  uint32_t loop_period_mean_us;
+  uint32_t frames_received;     // Valid frames accepted
+  uint32_t crc_failures;        // Frames rejected (STX/ETX/LEN/CRC)
+  uint32_t nacks_sent;
+  uint32_t buffer_overflows;    // RX ring/frame buffer bytes or frames dropped
+  uint32_t actuator_updates;    // Servo writes (ESP-BC) / LED fades (ESP-E)
+};
+static_assert(sizeof(EspStats) == 32, "EspStats must be 32 bytes");
+
+// RasPi -> ESP baud switch (4 bytes). The ESP ACKs at the old rate
+// (flushed) before switching, then reverts to BAUD_DEFAULT if no valid
+// frame arrives within BAUD_CONFIRM_TIMEOUT_MS - a failed negotiation
+// can never strand the link at a rate the Pi gave up on.
+struct __attribute__((packed)) SetBaudCommand {
+  uint32_t baud;            // Requested rate (must pass baud_allowed)
+};
+static_assert(sizeof(SetBaudCommand) == 4, "SetBaudCommand must be 4 bytes");
+
+// ============================================
+// Frame Encode / Decode
+// ============================================
+
+// Zero-copy view into a validated RX frame (payload points into the RX buffer)
+struct FrameView {
+  uint8_t cmd;              // CMD/ACK/NACK byte
+  uint8_t len;              // Payload length
+  const uint8_t* payload;   // Points into caller's buffer (not copied)
+  bool valid;               // True if structure, length and CRC all check out
+};
+
+// Validate a complete frame and return a view into it.
+// On failure valid=false; callers decide whether to NACK or drop.
+inline FrameView decode_frame(const uint8_t* buf, size_t total_len) {
+  FrameView view = {0, 0, nullptr, false};
+
+  if (total_len < FRAME_OVERHEAD) return view;
+  if (buf[0] != STX || buf[total_len - 1] != ETX) return view;
+
+  uint8_t payload_len = buf[2];
+  if (total_len != FRAME_OVERHEAD + payload_len) return view;
+
+  // CRC over CMD + LEN + PAYLOAD
+  if (buf[total_len - 2] != crc8_maxim(&buf[1], 2 + payload_len)) return view;
+
+  view.cmd = buf[1];
+  view.len = payload_len;
+  view.payload = &buf[3];
+  view.valid = true;
+  return view;
+}
+
+// Reinterpret a validated frame payload as a packed struct (zero-copy).
+// Returns nullptr if the payload length does not match the struct.
+template <typename T>
+inline const T* payload_as(const FrameView& view) {
+  if (!view.valid || view.len != sizeof(T)) return nullptr;
+  return reinterpret_cast<const T*>(view.payload);
+}
+
+// Encode a frame with a packed payload struct. Buffer must hold
+// sizeof(T) + FRAME_OVERHEAD bytes. Returns total frame length.
+template <typename T>
+inline size_t encode_frame(uint8_t* out, uint8_t cmd, const T& payload) {
+  out[0] = STX;
+  out[1] = cmd;
+  out[2] = (uint8_t)sizeof(T);
+  memcpy(&out[3], &payload, sizeof(T));
+  out[3 + sizeof(T)] = crc8_maxim(&out[1], 2 + sizeof(T));
+  out[4 + sizeof(T)] = ETX;
+  return FRAME_OVERHEAD + sizeof(T);
+}
+
+// Encode a payload-less frame (ACK, NACK, PING). Buffer must hold 5 bytes.
+inline size_t encode_empty_frame(uint8_t* out, uint8_t cmd) {
+  out[0] = STX;
+  out[1] = cmd;
+  out[2] = 0;
+  uint8_t crc_data[2] = {cmd, 0};
+  out[3] = crc8_maxim(crc_data, 2);
+  out[4] = ETX;
+  return FRAME_OVERHEAD;
+}
+
+}  // namespace pltn
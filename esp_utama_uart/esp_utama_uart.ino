@@ -25,40 +25,29 @@
  */
 
 #include <ESP32Servo.h>
+#include <esp_timer.h>     // Microsecond timestamps for loop period stats
+#include <PLTNProtocol.h>  // Shared codec (framing, table-driven CRC8, packed structs)
 
-// ============================================
-// Binary Protocol Constants
-// ============================================
-#define STX 0x02          // Start of Text
-#define ETX 0x03          // End of Text
-#define ACK 0x06          // Acknowledge
-#define NACK 0x15         // Negative Acknowledge
-#define CMD_PING 0x50     // 'P' - Ping command
-#define CMD_UPDATE 0x55   // 'U' - Update command
-
-// Message lengths
-#define PING_CMD_LEN 5    // [STX][CMD][LEN=0][CRC][ETX]
-#define UPDATE_CMD_LEN 15 // [STX][CMD][LEN=10][rod1][rod2][rod3][pump1][pump2][pump3][h1][h2][h3][h4][CRC][ETX]
-#define PING_RESP_LEN 5   // [STX][ACK][LEN=0][CRC][ETX]
-#define UPDATE_RESP_LEN 28 // [STX][ACK][LEN=23][23 bytes data][CRC][ETX]
+using namespace pltn;
 
 // ============================================
-// CRC8 Checksum (CRC-8/MAXIM)
+// Binary Protocol (see esp_common/PLTNProtocol)
 // ============================================
-uint8_t crc8_maxim(const uint8_t* data, size_t len) {
-  uint8_t crc = 0x00;
-  for (size_t i = 0; i < len; i++) {
-    crc ^= data[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x31;
-      } else {
-        crc = crc << 1;
-      }
-    }
-  }
-  return crc;
-}
+// Constants (STX/ETX/ACK/NACK, CMD_*) and CRC8 come from PLTNProtocol.h.
+// Message lengths:
+// - Ping command:    5 bytes  [STX][CMD][LEN=0][CRC][ETX]
+// - Update command: 15 bytes  [STX][CMD][LEN=10][EspBcCommand][CRC][ETX]
+// - Stream command:  7 bytes  [STX][CMD][LEN=2][StreamCommand][CRC][ETX]
+// - Stats command:   5 bytes  [STX][CMD][LEN=0][CRC][ETX]
+// - Update response:28 bytes  [STX][ACK][LEN=23][EspBcTelemetry][CRC][ETX]
+// - Stats response: 37 bytes  [STX][ACK][LEN=32][EspStats][CRC][ETX]
+
+// Streaming telemetry configuration
+// When stream_interval_ms > 0 the ESP pushes the 23-byte telemetry frame
+// unsolicited at that rate. Commands are then only needed when setpoints
+// change, eliminating the poll/ACK round-trip from the RasPi hot loop.
+#define STREAM_INTERVAL_MIN_MS 20   // Fastest allowed push rate (50Hz)
+#define STREAM_INTERVAL_MAX_MS 1000 // Slowest allowed push rate (1Hz)
 
 // ============================================
 // UART Configuration
@@ -66,6 +55,20 @@ uint8_t crc8_maxim(const uint8_t* data, size_t len) {
 #define UART_BAUD 115200
 HardwareSerial UartComm(2);  // UART2 (GPIO 16=RX, 17=TX)
 
+// ============================================
+// RX Ring Buffer (fed by UART onReceive callback)
+// ============================================
+// The onReceive callback drains the UART driver FIFO into this ring as
+// soon as data arrives, instead of loop() polling available() once per
+// 10ms tick. Single producer (UART event task) / single consumer (loop),
+// lock-free via separate head/tail indices. Size must be a power of two.
+#define RX_RING_SIZE 256
+#define RX_RING_MASK (RX_RING_SIZE - 1)
+volatile uint8_t rx_ring[RX_RING_SIZE];
+volatile uint16_t rx_ring_head = 0;  // Written by producer only
+volatile uint16_t rx_ring_tail = 0;  // Written by consumer only
+volatile uint32_t rx_ring_overflow = 0;  // Bytes dropped when ring full
+
 // ============================================
 // Binary Message Buffer
 // ============================================
@@ -83,6 +86,150 @@ RxState rx_state = WAIT_STX;
 unsigned long last_byte_time = 0;
 #define RX_TIMEOUT_MS 500  // Reset buffer if no data for 500ms
 
+// Streaming telemetry state (0 = streaming disabled, poll/ACK mode)
+uint16_t stream_interval_ms = 0;
+unsigned long last_stream_time = 0;
+
+// High-baud negotiation: after a CMD_SET_BAUD switch the new link must
+// be confirmed by any valid frame (the Pi pings immediately). If the
+// deadline passes unconfirmed, revert to BAUD_DEFAULT so a failed
+// switch can't strand the link.
+unsigned long baud_confirm_deadline = 0;  // 0 = no unconfirmed switch
+
+// Control tick period (outputs refreshed at 100Hz)
+#define CONTROL_PERIOD_MS 10
+
+// ============================================
+// Output Stage Cache (change detection)
+// ============================================
+// Last values actually written to hardware. The apply functions only
+// touch a servo/relay/PWM channel when its value changed, so in steady
+// state (most of exhibition time) the output stage costs a few integer
+// compares instead of re-arming servo pulses and PWM every 10ms. A
+// periodic full refresh re-writes everything anyway as a safety net
+// against glitched outputs (driver brown-out, ESD on the panel).
+#define OUTPUT_REFRESH_MS 1000
+
+int out_angle_safety = -1;       // Servo angles (deg), -1 = never written
+int out_angle_shim = -1;
+int out_angle_regulating = -1;
+int out_relay_ct1 = -1;          // Relay levels (HIGH/LOW)
+int out_relay_ct2 = -1;
+int out_relay_ct3 = -1;
+int out_relay_ct4 = -1;
+int out_pwm_primary = -1;        // PWM duties (0-255)
+int out_pwm_secondary = -1;
+int out_pwm_tertiary = -1;
+int out_pwm_turbine = -1;
+int out_turbine_dir = -1;        // MOTOR_FORWARD/REVERSE/STOP
+unsigned long last_output_refresh = 0;
+
+void invalidateOutputCache() {
+  out_angle_safety = out_angle_shim = out_angle_regulating = -1;
+  out_relay_ct1 = out_relay_ct2 = out_relay_ct3 = out_relay_ct4 = -1;
+  out_pwm_primary = out_pwm_secondary = out_pwm_tertiary = out_pwm_turbine = -1;
+  out_turbine_dir = -1;
+}
+
+// ============================================
+// Fixed-Timestep Simulation Engine
+// ============================================
+// Physics state advances in fixed SIM_DT steps driven by a micros()-based
+// accumulator, so simulated ramp rates no longer depend on how long UART
+// parsing or Serial.printf took that pass. All rates are expressed
+// per-second and scaled by dt inside the tick functions. This also lets
+// the control loop run at any speed without changing simulated behavior
+// (prerequisite for the faster-than-real-time test mode).
+#define SIM_DT_US 10000UL            // 10ms fixed simulation timestep
+#define SIM_DT_S  0.01f
+#define SIM_MAX_CATCHUP_TICKS 25     // Cap catch-up after a stall (250ms)
+
+// Simulation rates (per second)
+const float ROD_MOVE_RATE = 50.0;          // Rod travel, % per second
+const float TURBINE_RAMP_UP_RATE = 50.0;   // power_level rise in STARTING
+const float TURBINE_RAMP_DOWN_RATE = 100.0; // power_level fall in SHUTDOWN
+const float PUMP_RAMP_UP_RATE = 100.0;     // Pump actual rise, % per second
+const float PUMP_RAMP_DOWN_RATE = 200.0;   // Pump actual fall, % per second
+
+// ============================================
+// Dual-Core Task Split (comm core 0 / control core 1)
+// ============================================
+// The comm task owns the binary protocol (RX ring drain, frame parsing,
+// responses, streaming push) and the control task drives servos, PWM and
+// relays on a fixed 10ms period via vTaskDelayUntil. The two exchange
+// state through small double-buffered snapshots: the writer fills the
+// inactive buffer then flips the index. Single writer / single reader in
+// each direction, so no locks - and a burst of Serial debug or CRC work
+// in the comm task can no longer delay servo interpolation.
+
+// Setpoints: comm task (writer) -> control task (reader)
+struct CommandSnapshot {
+  float safety_final_target = 0.0;
+  float shim_final_target = 0.0;
+  float regulating_final_target = 0.0;
+  int pump_primary_cmd = 0;
+  int pump_secondary_cmd = 0;
+  int pump_tertiary_cmd = 0;
+  uint8_t humid_ct1_cmd = 0;
+  uint8_t humid_ct2_cmd = 0;
+  uint8_t humid_ct3_cmd = 0;
+  uint8_t humid_ct4_cmd = 0;
+};
+
+// Telemetry: control task (writer) -> comm task (reader)
+struct TelemetrySnapshot {
+  int safety_actual = 0;
+  int shim_actual = 0;
+  int regulating_actual = 0;
+  float thermal_kw = 0.0;
+  float power_level = 0.0;
+  uint8_t state = 0;
+  float turbine_speed = 0.0;
+  float pump_primary_actual = 0.0;
+  float pump_secondary_actual = 0.0;
+  float pump_tertiary_actual = 0.0;
+  uint8_t humid_ct1_status = 0;
+  uint8_t humid_ct2_status = 0;
+  uint8_t humid_ct3_status = 0;
+  uint8_t humid_ct4_status = 0;
+};
+
+CommandSnapshot cmd_snapshot[2];
+volatile uint8_t cmd_snapshot_active = 0;
+
+TelemetrySnapshot tel_snapshot[2];
+volatile uint8_t tel_snapshot_active = 0;
+
+void publishCommandSnapshot(const CommandSnapshot& cmd) {
+  uint8_t next = 1 - cmd_snapshot_active;
+  cmd_snapshot[next] = cmd;
+  cmd_snapshot_active = next;
+}
+
+void publishTelemetrySnapshot(const TelemetrySnapshot& tel) {
+  uint8_t next = 1 - tel_snapshot_active;
+  tel_snapshot[next] = tel;
+  tel_snapshot_active = next;
+}
+
+// ============================================
+// UART RX Callback (runs in UART event task)
+// ============================================
+void onUartReceive() {
+  // Drain driver FIFO into the lock-free ring buffer
+  while (UartComm.available()) {
+    uint16_t next_head = (rx_ring_head + 1) & RX_RING_MASK;
+    if (next_head == rx_ring_tail) {
+      // Ring full - drop byte (frame CRC will catch the damage)
+      UartComm.read();
+      rx_ring_overflow++;
+      continue;
+    }
+    rx_ring[rx_ring_head] = (uint8_t)UartComm.read();
+    rx_ring_head = next_head;
+  }
+}
+
 // ============================================
 // Control Rod Servos
 // ============================================
@@ -94,12 +241,8 @@ const int SERVO_PIN_SAFETY = 13;
 const int SERVO_PIN_SHIM = 12;
 const int SERVO_PIN_REGULATING = 14;
 
-// Rod positions (0-100%)
-int safety_target = 0;
-int shim_target = 0;
-int regulating_target = 0;
-
 // Final desired targets (for smooth motion)
+// Owned by the control task; refreshed from the command snapshot each tick
 float safety_final_target = 0.0;
 float shim_final_target = 0.0;
 float regulating_final_target = 0.0;
@@ -183,120 +326,178 @@ int pump_primary_cmd = 0;
 int pump_secondary_cmd = 0;
 int pump_tertiary_cmd = 0;
 
+// ============================================
+// Delta Protocol State (comm task only)
+// ============================================
+// Generation counts applied update commands (mod 256) and is echoed in
+// every telemetry frame. A CMD_KEEPALIVE carrying a stale generation is
+// NACKed so the Pi knows to resend the full command (e.g. after reboot).
+uint8_t cmd_generation = 0;
+
+// Last telemetry frame actually sent - keepalives get a short ACK
+// unless the current telemetry differs from this beyond thresholds
+EspBcTelemetry last_reported_telemetry;
+bool telemetry_reported = false;
+
+// thermal_kw is continuous; everything else is quantized on the wire so
+// an exact compare is already threshold'd at wire resolution
+#define TELEMETRY_THERMAL_THRESHOLD_KW 100.0f
+
+// ============================================
+// Performance Counters (CMD_STATS)
+// ============================================
+// Cheap counters the Pi can read over the link with CMD_STATS, since the
+// USB debug serial is unreachable in the installed cabinet. Aligned
+// 32-bit writes are atomic on ESP32, so the comm task can snapshot the
+// control task's loop stats without locks (worst case: one stale tick).
+// Event counters are cumulative since boot; the loop period window
+// resets on every CMD_STATS read.
+volatile uint32_t stats_frames_received = 0;   // Comm task: valid frames
+volatile uint32_t stats_crc_failures = 0;      // Comm task: rejected frames
+volatile uint32_t stats_nacks_sent = 0;        // Comm task
+volatile uint32_t stats_frame_overflows = 0;   // Comm task: rx_buffer resets
+volatile uint32_t stats_servo_updates = 0;     // Control task: servo writes
+volatile uint32_t stats_loop_min_us = UINT32_MAX;  // Control tick period window
+volatile uint32_t stats_loop_max_us = 0;
+volatile uint32_t stats_loop_sum_us = 0;
+volatile uint32_t stats_loop_count = 0;
+
+void recordLoopPeriod(uint32_t period_us) {
+  if (period_us < stats_loop_min_us) stats_loop_min_us = period_us;
+  if (period_us > stats_loop_max_us) stats_loop_max_us = period_us;
+  // Guard the mean accumulator if stats are never read (~70min at 10ms)
+  if (stats_loop_sum_us > 0xF0000000UL) {
+    stats_loop_sum_us = 0;
+    stats_loop_count = 0;
+  }
+  stats_loop_sum_us += period_us;
+  stats_loop_count++;
+}
+
 // ============================================
 // Binary Protocol Functions
 // ============================================
 
 void sendNACK() {
   // Send NACK response: [STX][NACK][LEN=0][CRC][ETX]
-  uint8_t response[5];
-  response[0] = STX;
-  response[1] = NACK;
-  response[2] = 0;  // LEN = 0 (no payload)
-  
-  // Calculate CRC over CMD + LEN
-  uint8_t crc_data[2] = {NACK, 0};
-  response[3] = crc8_maxim(crc_data, 2);
-  response[4] = ETX;
-  
-  UartComm.write(response, 5);
+  uint8_t response[FRAME_OVERHEAD];
+  size_t len = encode_empty_frame(response, NACK);
+
+  UartComm.write(response, len);
   UartComm.flush();
-  
+
+  stats_nacks_sent++;
   Serial.println("TX: NACK");
 }
 
+void sendACK() {
+  // Send plain ACK response: [STX][ACK][LEN=0][CRC][ETX]
+  // Used for commands that carry no return data (CMD_STREAM, and
+  // CMD_UPDATE while streaming - telemetry arrives via stream frames)
+  uint8_t response[FRAME_OVERHEAD];
+  size_t len = encode_empty_frame(response, ACK);
+
+  UartComm.write(response, len);
+  UartComm.flush();
+
+  Serial.println("TX: ACK");
+}
+
 void sendPongResponse() {
   // Send pong response: [STX][ACK][LEN=0][CRC][ETX]
-  uint8_t response[5];
-  response[0] = STX;
-  response[1] = ACK;
-  response[2] = 0;  // LEN = 0 (no payload)
-  
-  // Calculate CRC over CMD + LEN
-  uint8_t crc_data[2] = {ACK, 0};
-  response[3] = crc8_maxim(crc_data, 2);
-  response[4] = ETX;
-  
-  UartComm.write(response, 5);
+  uint8_t response[FRAME_OVERHEAD];
+  size_t len = encode_empty_frame(response, ACK);
+
+  UartComm.write(response, len);
   UartComm.flush();
-  
+
   Serial.println("TX: Pong ACK");
 }
 
+void buildTelemetryFrame(EspBcTelemetry& telemetry) {
+  // Reads the double-buffered snapshot published by the control task
+  TelemetrySnapshot tel = tel_snapshot[tel_snapshot_active];
+
+  telemetry.rod_safety = (uint8_t)tel.safety_actual;
+  telemetry.rod_shim = (uint8_t)tel.shim_actual;
+  telemetry.rod_regulating = (uint8_t)tel.regulating_actual;
+  telemetry.thermal_kw = tel.thermal_kw;
+  telemetry.power_level = (uint16_t)(tel.power_level * 100.0);  // 0-10000 for 0.00-100.00%
+  telemetry.state = tel.state;
+  telemetry.turbine_speed = (uint16_t)(tel.turbine_speed * 100.0);
+  telemetry.pump_primary = (uint16_t)(tel.pump_primary_actual * 100.0);
+  telemetry.pump_secondary = (uint16_t)(tel.pump_secondary_actual * 100.0);
+  telemetry.pump_tertiary = (uint16_t)(tel.pump_tertiary_actual * 100.0);
+  telemetry.humid_ct1 = tel.humid_ct1_status;
+  telemetry.humid_ct2 = tel.humid_ct2_status;
+  telemetry.humid_ct3 = tel.humid_ct3_status;
+  telemetry.humid_ct4 = tel.humid_ct4_status;
+  telemetry.cmd_generation = cmd_generation;
+}
+
+bool telemetryChanged(const EspBcTelemetry& telemetry) {
+  if (!telemetry_reported) return true;
+
+  if (fabs(telemetry.thermal_kw - last_reported_telemetry.thermal_kw) >=
+      TELEMETRY_THERMAL_THRESHOLD_KW) {
+    return true;
+  }
+
+  // Compare the remaining (quantized) fields byte-wise with thermal zeroed
+  EspBcTelemetry a = telemetry;
+  EspBcTelemetry b = last_reported_telemetry;
+  a.thermal_kw = 0.0f;
+  b.thermal_kw = 0.0f;
+  return memcmp(&a, &b, sizeof(EspBcTelemetry)) != 0;
+}
+
 void sendUpdateResponse() {
-  // Send update response: [STX][ACK][LEN=23][23 bytes data][CRC][ETX]
-  uint8_t response[28];
-  response[0] = STX;
-  response[1] = ACK;
-  response[2] = 23;  // LEN = 23 bytes payload
-  
-  // Pack data (23 bytes total)
-  uint8_t* data = &response[3];
-  
-  // Rods (3 bytes)
-  data[0] = (uint8_t)safety_actual;
-  data[1] = (uint8_t)shim_actual;
-  data[2] = (uint8_t)regulating_actual;
-  
-  // Thermal power (4 bytes, float32, little-endian)
-  memcpy(&data[3], &thermal_kw_calculated, 4);
-  
-  // Power level (2 bytes, uint16, 0-10000 for 0.00-100.00%)
-  uint16_t power_lvl_int = (uint16_t)(power_level * 100.0);
-  data[7] = power_lvl_int & 0xFF;
-  data[8] = (power_lvl_int >> 8) & 0xFF;
-  
-  // State (1 byte)
-  data[9] = (uint8_t)current_state;
-  
-  // Turbine speed (2 bytes, uint16, 0-10000)
-  uint16_t turb_spd_int = (uint16_t)(turbine_speed * 100.0);
-  data[10] = turb_spd_int & 0xFF;
-  data[11] = (turb_spd_int >> 8) & 0xFF;
-  
-  // Pump speeds (6 bytes, 3x uint16)
-  uint16_t pump1_int = (uint16_t)(pump_primary_actual * 100.0);
-  uint16_t pump2_int = (uint16_t)(pump_secondary_actual * 100.0);
-  uint16_t pump3_int = (uint16_t)(pump_tertiary_actual * 100.0);
-  
-  data[12] = pump1_int & 0xFF;
-  data[13] = (pump1_int >> 8) & 0xFF;
-  data[14] = pump2_int & 0xFF;
-  data[15] = (pump2_int >> 8) & 0xFF;
-  data[16] = pump3_int & 0xFF;
-  data[17] = (pump3_int >> 8) & 0xFF;
-  
-  // Humidifier status (4 bytes)
-  data[18] = humid_ct1_status;
-  data[19] = humid_ct2_status;
-  data[20] = humid_ct3_status;
-  data[21] = humid_ct4_status;
-  
-  // Reserved (1 byte) - for future use
-  data[22] = 0;
-  
-  // Calculate CRC over CMD + LEN + data (25 bytes total)
-  response[26] = crc8_maxim(&response[1], 25);
-  response[27] = ETX;
-  
-  UartComm.write(response, 28);
+  // Send update response: [STX][ACK][LEN=23][EspBcTelemetry][CRC][ETX]
+  EspBcTelemetry telemetry;
+  buildTelemetryFrame(telemetry);
+
+  uint8_t response[sizeof(EspBcTelemetry) + FRAME_OVERHEAD];
+  size_t len = encode_frame(response, ACK, telemetry);
+
+  UartComm.write(response, len);
   UartComm.flush();
-  
+
+  last_reported_telemetry = telemetry;
+  telemetry_reported = true;
+
   Serial.println("TX: Update ACK with data");
 }
 
+void sendStatsResponse() {
+  // Send performance counters: [STX][ACK][LEN=32][EspStats][CRC][ETX]
+  EspStats stats;
+  uint32_t count = stats_loop_count;
+  stats.loop_period_min_us = (count > 0) ? stats_loop_min_us : 0;
+  stats.loop_period_max_us = stats_loop_max_us;
+  stats.loop_period_mean_us = (count > 0) ? stats_loop_sum_us / count : 0;
+  stats.frames_received = stats_frames_received;
+  stats.crc_failures = stats_crc_failures;
+  stats.nacks_sent = stats_nacks_sent;
+  stats.buffer_overflows = rx_ring_overflow + stats_frame_overflows;
+  stats.actuator_updates = stats_servo_updates;
+
+  // Reset the loop period window - the next report covers the interval
+  // from this read onward
+  stats_loop_min_us = UINT32_MAX;
+  stats_loop_max_us = 0;
+  stats_loop_sum_us = 0;
+  stats_loop_count = 0;
+
+  uint8_t response[sizeof(EspStats) + FRAME_OVERHEAD];
+  size_t len = encode_frame(response, ACK, stats);
+
+  UartComm.write(response, len);
+  UartComm.flush();
+
+  Serial.println("TX: Stats");
+}
+
 void processBinaryMessage(uint8_t* msg, uint8_t len) {
-  // Validate message structure
-  if (len < 5) {
-    Serial.println("Message too short");
-    return;
-  }
-  
-  if (msg[0] != STX || msg[len-1] != ETX) {
-    Serial.println("Invalid STX/ETX");
-    return;
-  }
-  
   // DEBUG: Print received message
   Serial.print("RX bytes: [");
   for (uint8_t i = 0; i < len; i++) {
@@ -304,76 +505,145 @@ void processBinaryMessage(uint8_t* msg, uint8_t len) {
     if (i < len-1) Serial.print(" ");
   }
   Serial.printf("] (%d bytes)\n", len);
-  
-  // Extract fields: [STX][CMD][LEN][PAYLOAD...][CRC][ETX]
-  uint8_t cmd = msg[1];
-  uint8_t payload_len = msg[2];
-  uint8_t received_crc = msg[len-2];
-  
-  // Validate total message length
-  uint8_t expected_len = 5 + payload_len;  // STX + CMD + LEN + PAYLOAD + CRC + ETX
-  if (len != expected_len) {
-    Serial.printf("Length mismatch: got %d bytes, expected %d (LEN field=%d)\n", len, expected_len, payload_len);
-    sendNACK();
-    return;
-  }
-  
-  // Validate CRC (over CMD + LEN + PAYLOAD)
-  uint8_t crc_len = 2 + payload_len;  // CMD + LEN + payload
-  Serial.printf("CRC calculation: &msg[1], len=%d\n", crc_len);
-  uint8_t calculated_crc = crc8_maxim(&msg[1], crc_len);
-  
-  if (received_crc != calculated_crc) {
-    Serial.printf("CRC mismatch: received=0x%02X, calculated=0x%02X\n", received_crc, calculated_crc);
+
+  // Validate frame (structure, length and CRC) - zero-copy view into msg
+  FrameView frame = decode_frame(msg, len);
+  if (!frame.valid) {
+    stats_crc_failures++;
+    Serial.println("Invalid frame (STX/ETX/LEN/CRC)");
     sendNACK();
     return;
   }
-  
+
+  stats_frames_received++;
+
+  // Any valid frame confirms a pending baud switch
+  baud_confirm_deadline = 0;
+
   // Process command
-  if (cmd == CMD_PING) {
-    if (payload_len != 0) {
-      Serial.printf("Invalid ping payload length: %d (expected 0)\n", payload_len);
+  if (frame.cmd == CMD_PING) {
+    if (frame.len != 0) {
+      Serial.printf("Invalid ping payload length: %d (expected 0)\n", frame.len);
       sendNACK();
       return;
     }
     Serial.println("RX: Ping");
     sendPongResponse();
   }
-  else if (cmd == CMD_UPDATE) {
-    if (payload_len != 10) {
-      Serial.printf("Invalid update payload length: %d (expected 10)\n", payload_len);
+  else if (frame.cmd == CMD_UPDATE) {
+    const EspBcCommand* update = payload_as<EspBcCommand>(frame);
+    if (update == nullptr) {
+      Serial.printf("Invalid update payload length: %d (expected %d)\n", frame.len, (int)sizeof(EspBcCommand));
       sendNACK();
       return;
     }
-    
-    // Parse update data (payload starts at index 3)
-    safety_target = msg[3];
-    shim_target = msg[4];
-    regulating_target = msg[5];
-    
-    pump_primary_cmd = msg[6];
-    pump_secondary_cmd = msg[7];
-    pump_tertiary_cmd = msg[8];
-    
-    humid_ct1_cmd = msg[9];
-    humid_ct2_cmd = msg[10];
-    humid_ct3_cmd = msg[11];
-    humid_ct4_cmd = msg[12];
-    
-    // Update targets
-    safety_final_target = constrain(safety_target, 0, 100);
-    shim_final_target = constrain(shim_target, 0, 100);
-    regulating_final_target = constrain(regulating_target, 0, 100);
-    
+
+    // Parse update data (zero-copy view into RX buffer) and hand the
+    // setpoints to the control task via the double-buffered snapshot
+    CommandSnapshot cmd;
+    cmd.safety_final_target = constrain(update->rod_safety, 0, 100);
+    cmd.shim_final_target = constrain(update->rod_shim, 0, 100);
+    cmd.regulating_final_target = constrain(update->rod_regulating, 0, 100);
+
+    cmd.pump_primary_cmd = update->pump_primary;
+    cmd.pump_secondary_cmd = update->pump_secondary;
+    cmd.pump_tertiary_cmd = update->pump_tertiary;
+
+    cmd.humid_ct1_cmd = update->humid_ct1;
+    cmd.humid_ct2_cmd = update->humid_ct2;
+    cmd.humid_ct3_cmd = update->humid_ct3;
+    cmd.humid_ct4_cmd = update->humid_ct4;
+
+    publishCommandSnapshot(cmd);
+    cmd_generation++;  // Wraps mod 256, echoed in telemetry frames
+
     Serial.printf("RX: Update - Rods=[%d,%d,%d], Pumps=[%d,%d,%d], Humid=[%d,%d,%d,%d]\n",
-                  safety_target, shim_target, regulating_target,
-                  pump_primary_cmd, pump_secondary_cmd, pump_tertiary_cmd,
-                  humid_ct1_cmd, humid_ct2_cmd, humid_ct3_cmd, humid_ct4_cmd);
-    
-    sendUpdateResponse();
+                  update->rod_safety, update->rod_shim, update->rod_regulating,
+                  update->pump_primary, update->pump_secondary, update->pump_tertiary,
+                  update->humid_ct1, update->humid_ct2, update->humid_ct3, update->humid_ct4);
+
+    if (stream_interval_ms > 0) {
+      // Streaming mode: telemetry is pushed unsolicited, so the command
+      // only needs a short ACK (keeps button-to-servo latency minimal)
+      sendACK();
+    } else {
+      sendUpdateResponse();
+    }
+  }
+  else if (frame.cmd == CMD_KEEPALIVE) {
+    const KeepaliveCommand* keepalive = payload_as<KeepaliveCommand>(frame);
+    if (keepalive == nullptr) {
+      Serial.printf("Invalid keepalive payload length: %d (expected %d)\n", frame.len, (int)sizeof(KeepaliveCommand));
+      sendNACK();
+      return;
+    }
+
+    if (keepalive->cmd_generation != cmd_generation) {
+      // Pi's view of the command state is stale (lost command or this
+      // side rebooted) - NACK so it resends the full update
+      Serial.printf("RX: Keepalive generation mismatch (got %d, have %d)\n",
+                    keepalive->cmd_generation, cmd_generation);
+      sendNACK();
+      return;
+    }
+
+    // Generations match: reply with full telemetry only if it moved
+    // beyond reporting thresholds since the last frame we sent
+    EspBcTelemetry telemetry;
+    buildTelemetryFrame(telemetry);
+    if (telemetryChanged(telemetry)) {
+      sendUpdateResponse();
+    } else {
+      sendACK();
+    }
+  }
+  else if (frame.cmd == CMD_STREAM) {
+    const StreamCommand* stream = payload_as<StreamCommand>(frame);
+    if (stream == nullptr) {
+      Serial.printf("Invalid stream payload length: %d (expected %d)\n", frame.len, (int)sizeof(StreamCommand));
+      sendNACK();
+      return;
+    }
+
+    // interval_ms == 0 stops streaming
+    if (stream->interval_ms == 0) {
+      stream_interval_ms = 0;
+      Serial.println("RX: Stream OFF (back to poll/ACK mode)");
+    } else {
+      stream_interval_ms = constrain(stream->interval_ms, STREAM_INTERVAL_MIN_MS, STREAM_INTERVAL_MAX_MS);
+      last_stream_time = millis();
+      Serial.printf("RX: Stream ON - telemetry every %d ms\n", stream_interval_ms);
+    }
+
+    sendACK();
+  }
+  else if (frame.cmd == CMD_SET_BAUD) {
+    const SetBaudCommand* setbaud = payload_as<SetBaudCommand>(frame);
+    if (setbaud == nullptr || !baud_allowed(setbaud->baud)) {
+      Serial.println("RX: Invalid SET_BAUD request");
+      sendNACK();
+      return;
+    }
+
+    // ACK at the current rate first (sendACK flushes), then switch.
+    // The Pi pings at the new rate right away; if that never lands,
+    // the confirm deadline reverts us to BAUD_DEFAULT.
+    Serial.printf("RX: SET_BAUD %lu\n", (unsigned long)setbaud->baud);
+    sendACK();
+    UartComm.updateBaudRate(setbaud->baud);
+    baud_confirm_deadline = millis() + BAUD_CONFIRM_TIMEOUT_MS;
+  }
+  else if (frame.cmd == CMD_STATS) {
+    if (frame.len != 0) {
+      Serial.printf("Invalid stats payload length: %d (expected 0)\n", frame.len);
+      sendNACK();
+      return;
+    }
+    Serial.println("RX: Stats request");
+    sendStatsResponse();
   }
   else {
-    Serial.printf("Unknown command: 0x%02X\n", cmd);
+    Serial.printf("Unknown command: 0x%02X\n", frame.cmd);
     sendNACK();
   }
 }
@@ -393,10 +663,16 @@ void setup() {
   
   // Initialize UART2 for Raspberry Pi communication
   UartComm.begin(UART_BAUD, SERIAL_8N1, 16, 17);  // RX=16, TX=17
+
+  // Interrupt-driven RX: callback drains driver FIFO into ring buffer
+  // as soon as bytes arrive (no 10ms polling quantization)
+  UartComm.onReceive(onUartReceive);
+
   Serial.println("✅ UART2 initialized at 115200 baud");
   Serial.println("   RX: GPIO 16");
   Serial.println("   TX: GPIO 17");
   Serial.println("   Protocol: BINARY with ACK/NACK");
+  Serial.println("   RX mode: onReceive callback + ring buffer");
   
   // Initialize servos
   servo_safety.attach(SERVO_PIN_SAFETY);
@@ -404,7 +680,7 @@ void setup() {
   servo_regulating.attach(SERVO_PIN_REGULATING);
   
   // Set initial positions (0%)
-  updateServos();
+  applyRodOutputs();
   Serial.println("✅ Servos initialized");
   
   // Initialize relay pins (Cooling Tower only - 4 relays)
@@ -443,29 +719,46 @@ void setup() {
   Serial.println("   Direction Pins: GPIO 23, 15");
   Serial.println("   Pumps: Hard-wired FORWARD (no GPIO needed)");
   
+  // Start pinned tasks: comm on core 0, control on core 1
+  // Control gets the higher priority so its 10ms tick always wins
+  xTaskCreatePinnedToCore(commTask, "comm", 4096, NULL, 2, NULL, 0);
+  xTaskCreatePinnedToCore(controlTask, "control", 4096, NULL, 3, NULL, 1);
+  Serial.println("✅ Tasks started: comm (core 0), control (core 1, 10ms fixed period)");
+
   Serial.println("===========================================");
   Serial.println("✅ System Ready - Waiting for binary commands...");
   Serial.println("===========================================\n");
 }
 
 // ============================================
-// Main Loop
+// RX Ring Drain + Frame State Machine
 // ============================================
-void loop() {
-  // Read UART data with state machine for robust frame parsing
-  while (UartComm.available()) {
-    uint8_t byte = UartComm.read();
+void drainRxRing() {
+  // Report any bytes the producer had to drop (ring full)
+  static uint32_t last_overflow_report = 0;
+  if (rx_ring_overflow != last_overflow_report) {
+    Serial.printf("RX ring overflow: %lu bytes dropped total\n", (unsigned long)rx_ring_overflow);
+    last_overflow_report = rx_ring_overflow;
+  }
+
+  // Consume bytes from the ring with the frame state machine.
+  // Back-to-back frames stay in the ring and are parsed in order -
+  // no flush that could discard the start of the next command.
+  while (rx_ring_tail != rx_ring_head) {
+    uint8_t byte = rx_ring[rx_ring_tail];
+    rx_ring_tail = (rx_ring_tail + 1) & RX_RING_MASK;
+
     unsigned long current_time = millis();
-    
+
     // Check for timeout (reset to WAIT_STX if no data for 500ms)
     if (rx_state == IN_FRAME && (current_time - last_byte_time > RX_TIMEOUT_MS)) {
       Serial.println("RX timeout - resetting to WAIT_STX");
       rx_state = WAIT_STX;
       rx_index = 0;
     }
-    
+
     last_byte_time = current_time;
-    
+
     // State machine for frame parsing
     if (rx_state == WAIT_STX) {
       // Only accept STX when waiting for new frame
@@ -473,7 +766,6 @@ void loop() {
         rx_index = 0;
         rx_buffer[rx_index++] = byte;
         rx_state = IN_FRAME;
-        Serial.println("RX: STX detected, entering IN_FRAME state");
       }
       // Ignore all other bytes when waiting for STX
     }
@@ -481,92 +773,215 @@ void loop() {
       // Add byte to buffer
       if (rx_index < sizeof(rx_buffer)) {
         rx_buffer[rx_index++] = byte;
-        
+
         // Check if this is ETX (end of frame)
         if (byte == ETX) {
-          // DEBUG: Print complete frame
-          Serial.print("RX complete frame: [");
-          for (uint8_t i = 0; i < rx_index; i++) {
-            Serial.printf("%02X", rx_buffer[i]);
-            if (i < rx_index-1) Serial.print(" ");
-          }
-          Serial.printf("] (%d bytes)\n", rx_index);
-          
           // Process complete message
           processBinaryMessage(rx_buffer, rx_index);
-          
+
           // Return to WAIT_STX state
           rx_state = WAIT_STX;
           rx_index = 0;
-          
-          // Flush any remaining garbage in buffer
-          while (UartComm.available()) {
-            UartComm.read();
-          }
         }
       }
       else {
         // Buffer overflow - reset to WAIT_STX
+        stats_frame_overflows++;
         Serial.println("Buffer overflow - resetting to WAIT_STX");
         rx_state = WAIT_STX;
         rx_index = 0;
       }
     }
   }
-  
-  // Update system state (only after reading all UART data)
-  updateServos();
-  calculateThermalPower();
-  updateTurbineState();
-  updateHumidifiers();
-  updatePumpSpeeds();
-  updateTurbineSpeed();
-  
-  yield();
-  delay(10);
 }
 
 // ============================================
-// Update Servos (same as before)
+// Comm Task (core 0) - binary protocol only
 // ============================================
-void updateServos() {
-  const float loop_dt = 0.01;
-  const float max_delta = 50.0 * loop_dt;  // 50% per second
-  
+void commTask(void* pvParameters) {
+  Serial.printf("Comm task running on core %d\n", xPortGetCoreID());
+
+  for (;;) {
+    // Parse any frames the onReceive callback has queued (~1ms latency)
+    drainRxRing();
+
+    // Revert an unconfirmed baud switch (Pi never reached us at the new rate)
+    if (baud_confirm_deadline != 0 && millis() > baud_confirm_deadline) {
+      Serial.println("Baud switch unconfirmed - reverting to default rate");
+      UartComm.updateBaudRate(BAUD_DEFAULT);
+      baud_confirm_deadline = 0;
+    }
+
+    // Push unsolicited telemetry frame when streaming is enabled
+    if (stream_interval_ms > 0) {
+      unsigned long now = millis();
+      if (now - last_stream_time >= stream_interval_ms) {
+        sendUpdateResponse();
+        last_stream_time = now;
+      }
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
+}
+
+// ============================================
+// Control Task (core 1) - fixed-rate outputs
+// ============================================
+void controlTask(void* pvParameters) {
+  Serial.printf("Control task running on core %d\n", xPortGetCoreID());
+
+  TickType_t last_wake = xTaskGetTickCount();
+  unsigned long last_us = micros();
+  unsigned long sim_accumulator_us = 0;
+  int64_t last_tick_us = esp_timer_get_time();
+
+  for (;;) {
+    // Loop period stats: time between control ticks (target 10ms).
+    // Overruns show up here as max spikes, readable via CMD_STATS.
+    int64_t tick_us = esp_timer_get_time();
+    recordLoopPeriod((uint32_t)(tick_us - last_tick_us));
+    last_tick_us = tick_us;
+
+    // Refresh setpoints from the comm task's snapshot
+    CommandSnapshot cmd = cmd_snapshot[cmd_snapshot_active];
+    safety_final_target = cmd.safety_final_target;
+    shim_final_target = cmd.shim_final_target;
+    regulating_final_target = cmd.regulating_final_target;
+    pump_primary_cmd = cmd.pump_primary_cmd;
+    pump_secondary_cmd = cmd.pump_secondary_cmd;
+    pump_tertiary_cmd = cmd.pump_tertiary_cmd;
+    humid_ct1_cmd = cmd.humid_ct1_cmd;
+    humid_ct2_cmd = cmd.humid_ct2_cmd;
+    humid_ct3_cmd = cmd.humid_ct3_cmd;
+    humid_ct4_cmd = cmd.humid_ct4_cmd;
+
+    // Fixed-timestep simulation: accumulate real elapsed time and run
+    // whole SIM_DT_US ticks. If the task wakes late (scheduler jitter,
+    // WiFi stack, etc.) it catches up with extra ticks, so motion rates
+    // stay in real units per second instead of per-iteration steps.
+    unsigned long now_us = micros();
+    sim_accumulator_us += now_us - last_us;  // unsigned math handles micros() wrap
+    last_us = now_us;
+
+    int ticks = 0;
+    while (sim_accumulator_us >= SIM_DT_US && ticks < SIM_MAX_CATCHUP_TICKS) {
+      updateRodMotion(SIM_DT_S);
+      calculateThermalPower();
+      updateTurbineState(SIM_DT_S);
+      updatePumpRamps(SIM_DT_S);
+      updateTurbineSim();
+      sim_accumulator_us -= SIM_DT_US;
+      ticks++;
+    }
+    if (ticks == SIM_MAX_CATCHUP_TICKS) {
+      // Way behind (e.g. after a long stall) - drop the backlog rather
+      // than spiral trying to replay it
+      sim_accumulator_us = 0;
+    }
+
+    // Periodic safety net: drop the cache so every output gets re-written
+    // this pass even if its value is unchanged
+    unsigned long now_ms = millis();
+    if (now_ms - last_output_refresh >= OUTPUT_REFRESH_MS) {
+      invalidateOutputCache();
+      last_output_refresh = now_ms;
+    }
+
+    // Output stage: hardware written on change only, once per control period
+    applyRodOutputs();
+    updateHumidifiers();
+    applyPumpOutputs();
+    applyTurbineOutputs();
+
+    // Publish actuals for the comm task's responses/stream frames
+    TelemetrySnapshot tel;
+    tel.safety_actual = safety_actual;
+    tel.shim_actual = shim_actual;
+    tel.regulating_actual = regulating_actual;
+    tel.thermal_kw = thermal_kw_calculated;
+    tel.power_level = power_level;
+    tel.state = (uint8_t)current_state;
+    tel.turbine_speed = turbine_speed;
+    tel.pump_primary_actual = pump_primary_actual;
+    tel.pump_secondary_actual = pump_secondary_actual;
+    tel.pump_tertiary_actual = pump_tertiary_actual;
+    tel.humid_ct1_status = humid_ct1_status;
+    tel.humid_ct2_status = humid_ct2_status;
+    tel.humid_ct3_status = humid_ct3_status;
+    tel.humid_ct4_status = humid_ct4_status;
+    publishTelemetrySnapshot(tel);
+
+    // Hold the 10ms period exactly (no drift from work done this tick)
+    vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(CONTROL_PERIOD_MS));
+  }
+}
+
+// ============================================
+// Main Loop (idle - work runs in pinned tasks)
+// ============================================
+void loop() {
+  vTaskDelay(pdMS_TO_TICKS(1000));
+}
+
+// ============================================
+// Rod Motion (simulation state, fixed dt)
+// ============================================
+void updateRodMotion(float dt) {
+  const float max_delta = ROD_MOVE_RATE * dt;
+
   // Move safety_actual_f toward safety_final_target
   if (fabs(safety_actual_f - safety_final_target) > 0.001) {
     float diff = safety_final_target - safety_actual_f;
     if (fabs(diff) <= max_delta) safety_actual_f = safety_final_target;
     else safety_actual_f += (diff > 0 ? max_delta : -max_delta);
   }
-  
+
   // Move shim_actual_f toward shim_final_target
   if (fabs(shim_actual_f - shim_final_target) > 0.001) {
     float diff = shim_final_target - shim_actual_f;
     if (fabs(diff) <= max_delta) shim_actual_f = shim_final_target;
     else shim_actual_f += (diff > 0 ? max_delta : -max_delta);
   }
-  
+
   // Move regulating_actual_f toward regulating_final_target
   if (fabs(regulating_actual_f - regulating_final_target) > 0.001) {
     float diff = regulating_final_target - regulating_actual_f;
     if (fabs(diff) <= max_delta) regulating_actual_f = regulating_final_target;
     else regulating_actual_f += (diff > 0 ? max_delta : -max_delta);
   }
-  
+
   // Update integer snapshots
   safety_actual = (int)round(safety_actual_f);
   shim_actual = (int)round(shim_actual_f);
   regulating_actual = (int)round(regulating_actual_f);
-  
+}
+
+// ============================================
+// Rod Servo Outputs (applied once per control tick)
+// ============================================
+void applyRodOutputs() {
   // Map 0-100% to servo angle (0-180 degrees)
   int angle_safety = (int)map(safety_actual, 0, 100, 0, 180);
   int angle_shim = (int)map(shim_actual, 0, 100, 0, 180);
   int angle_regulating = (int)map(regulating_actual, 0, 100, 0, 180);
-  
-  servo_safety.write(angle_safety);
-  servo_shim.write(angle_shim);
-  servo_regulating.write(angle_regulating);
+
+  // Only re-arm a servo pulse when its angle actually changed
+  if (angle_safety != out_angle_safety) {
+    servo_safety.write(angle_safety);
+    out_angle_safety = angle_safety;
+    stats_servo_updates++;
+  }
+  if (angle_shim != out_angle_shim) {
+    servo_shim.write(angle_shim);
+    out_angle_shim = angle_shim;
+    stats_servo_updates++;
+  }
+  if (angle_regulating != out_angle_regulating) {
+    servo_regulating.write(angle_regulating);
+    out_angle_regulating = angle_regulating;
+    stats_servo_updates++;
+  }
 }
 
 // ============================================
@@ -596,9 +1011,9 @@ void calculateThermalPower() {
 }
 
 // ============================================
-// Update Turbine State (same as before)
+// Update Turbine State (fixed dt)
 // ============================================
-void updateTurbineState() {
+void updateTurbineState(float dt) {
   float avgRodPosition = (shim_actual + regulating_actual) / 2.0;
   float reactor_thermal_capacity = 0.0;
   
@@ -618,7 +1033,7 @@ void updateTurbineState() {
       break;
       
     case STATE_STARTING:
-      power_level += 0.5;
+      power_level += TURBINE_RAMP_UP_RATE * dt;
       if (power_level >= 100.0) {
         power_level = 100.0;
         current_state = STATE_RUNNING;
@@ -635,7 +1050,7 @@ void updateTurbineState() {
       break;
       
     case STATE_SHUTDOWN:
-      power_level -= 1.0;
+      power_level -= TURBINE_RAMP_DOWN_RATE * dt;
       if (power_level <= 0.0) {
         power_level = 0.0;
         current_state = STATE_IDLE;
@@ -649,11 +1064,29 @@ void updateTurbineState() {
 // Update Humidifiers (same as before)
 // ============================================
 void updateHumidifiers() {
-  digitalWrite(RELAY_CT1, humid_ct1_cmd ? LOW : HIGH);
-  digitalWrite(RELAY_CT2, humid_ct2_cmd ? LOW : HIGH);
-  digitalWrite(RELAY_CT3, humid_ct3_cmd ? LOW : HIGH);
-  digitalWrite(RELAY_CT4, humid_ct4_cmd ? LOW : HIGH);
-  
+  // Relays are low-level trigger: cmd 1 -> LOW, cmd 0 -> HIGH
+  int level_ct1 = humid_ct1_cmd ? LOW : HIGH;
+  int level_ct2 = humid_ct2_cmd ? LOW : HIGH;
+  int level_ct3 = humid_ct3_cmd ? LOW : HIGH;
+  int level_ct4 = humid_ct4_cmd ? LOW : HIGH;
+
+  if (level_ct1 != out_relay_ct1) {
+    digitalWrite(RELAY_CT1, level_ct1);
+    out_relay_ct1 = level_ct1;
+  }
+  if (level_ct2 != out_relay_ct2) {
+    digitalWrite(RELAY_CT2, level_ct2);
+    out_relay_ct2 = level_ct2;
+  }
+  if (level_ct3 != out_relay_ct3) {
+    digitalWrite(RELAY_CT3, level_ct3);
+    out_relay_ct3 = level_ct3;
+  }
+  if (level_ct4 != out_relay_ct4) {
+    digitalWrite(RELAY_CT4, level_ct4);
+    out_relay_ct4 = level_ct4;
+  }
+
   humid_ct1_status = humid_ct1_cmd;
   humid_ct2_status = humid_ct2_cmd;
   humid_ct3_status = humid_ct3_cmd;
@@ -679,102 +1112,85 @@ void setMotorDirection(uint8_t motor_id, uint8_t direction) {
 }
 
 // ============================================
-// Pump Gradual Speed Control (same as before)
+// Pump Gradual Speed Control (fixed dt)
 // ============================================
-void updatePumpSpeeds() {
-  // PRIMARY PUMP
-  if (pump_primary_cmd == 0) {
-    pump_primary_target = 0.0;
-  } else if (pump_primary_cmd == 1) {
-    pump_primary_target = 50.0;
-  } else if (pump_primary_cmd == 2) {
-    pump_primary_target = 100.0;
-  } else if (pump_primary_cmd == 3) {
-    pump_primary_target = 20.0;
-  }
-  
-  if (pump_primary_actual < pump_primary_target) {
-    pump_primary_actual += 1.0;
-    if (pump_primary_actual > pump_primary_target) {
-      pump_primary_actual = pump_primary_target;
-    }
-  } else if (pump_primary_actual > pump_primary_target) {
-    pump_primary_actual -= 2.0;
-    if (pump_primary_actual < pump_primary_target) {
-      pump_primary_actual = pump_primary_target;
-    }
-  }
-  
-  // SECONDARY PUMP
-  if (pump_secondary_cmd == 0) {
-    pump_secondary_target = 0.0;
-  } else if (pump_secondary_cmd == 1) {
-    pump_secondary_target = 50.0;
-  } else if (pump_secondary_cmd == 2) {
-    pump_secondary_target = 100.0;
-  } else if (pump_secondary_cmd == 3) {
-    pump_secondary_target = 20.0;
-  }
-  
-  if (pump_secondary_actual < pump_secondary_target) {
-    pump_secondary_actual += 1.0;
-    if (pump_secondary_actual > pump_secondary_target) {
-      pump_secondary_actual = pump_secondary_target;
-    }
-  } else if (pump_secondary_actual > pump_secondary_target) {
-    pump_secondary_actual -= 2.0;
-    if (pump_secondary_actual < pump_secondary_target) {
-      pump_secondary_actual = pump_secondary_target;
-    }
+// Helper: map pump command to target speed and ramp actual toward it
+void rampPump(int cmd, float* target, float* actual, float dt) {
+  if (cmd == 0) {
+    *target = 0.0;
+  } else if (cmd == 1) {
+    *target = 50.0;
+  } else if (cmd == 2) {
+    *target = 100.0;
+  } else if (cmd == 3) {
+    *target = 20.0;
   }
-  
-  // TERTIARY PUMP
-  if (pump_tertiary_cmd == 0) {
-    pump_tertiary_target = 0.0;
-  } else if (pump_tertiary_cmd == 1) {
-    pump_tertiary_target = 50.0;
-  } else if (pump_tertiary_cmd == 2) {
-    pump_tertiary_target = 100.0;
-  } else if (pump_tertiary_cmd == 3) {
-    pump_tertiary_target = 20.0;
-  }
-  
-  if (pump_tertiary_actual < pump_tertiary_target) {
-    pump_tertiary_actual += 1.0;
-    if (pump_tertiary_actual > pump_tertiary_target) {
-      pump_tertiary_actual = pump_tertiary_target;
+
+  if (*actual < *target) {
+    *actual += PUMP_RAMP_UP_RATE * dt;
+    if (*actual > *target) {
+      *actual = *target;
     }
-  } else if (pump_tertiary_actual > pump_tertiary_target) {
-    pump_tertiary_actual -= 2.0;
-    if (pump_tertiary_actual < pump_tertiary_target) {
-      pump_tertiary_actual = pump_tertiary_target;
+  } else if (*actual > *target) {
+    *actual -= PUMP_RAMP_DOWN_RATE * dt;
+    if (*actual < *target) {
+      *actual = *target;
     }
   }
-  
-  // Apply PWM to motor drivers (0-255)
+}
+
+void updatePumpRamps(float dt) {
+  rampPump(pump_primary_cmd, &pump_primary_target, &pump_primary_actual, dt);
+  rampPump(pump_secondary_cmd, &pump_secondary_target, &pump_secondary_actual, dt);
+  rampPump(pump_tertiary_cmd, &pump_tertiary_target, &pump_tertiary_actual, dt);
+}
+
+// ============================================
+// Pump PWM Outputs (applied once per control tick)
+// ============================================
+void applyPumpOutputs() {
+  // Apply PWM to motor drivers (0-255), skipping unchanged duties
   int pwm_primary = map((int)pump_primary_actual, 0, 100, 0, 255);
   int pwm_secondary = map((int)pump_secondary_actual, 0, 100, 0, 255);
   int pwm_tertiary = map((int)pump_tertiary_actual, 0, 100, 0, 255);
-  
-  ledcWrite(MOTOR_PUMP_PRIMARY, pwm_primary);
-  ledcWrite(MOTOR_PUMP_SECONDARY, pwm_secondary);
-  ledcWrite(MOTOR_PUMP_TERTIARY, pwm_tertiary);
+
+  if (pwm_primary != out_pwm_primary) {
+    ledcWrite(MOTOR_PUMP_PRIMARY, pwm_primary);
+    out_pwm_primary = pwm_primary;
+  }
+  if (pwm_secondary != out_pwm_secondary) {
+    ledcWrite(MOTOR_PUMP_SECONDARY, pwm_secondary);
+    out_pwm_secondary = pwm_secondary;
+  }
+  if (pwm_tertiary != out_pwm_tertiary) {
+    ledcWrite(MOTOR_PUMP_TERTIARY, pwm_tertiary);
+    out_pwm_tertiary = pwm_tertiary;
+  }
 }
 
 // ============================================
-// Turbine Motor Speed Control (same as before)
+// Turbine Motor Speed (state + outputs)
 // ============================================
-void updateTurbineSpeed() {
+void updateTurbineSim() {
+  // Turbine speed tracks rod position directly (no integration needed)
   float avg_control_rods = (shim_actual + regulating_actual) / 2.0;
   turbine_speed = avg_control_rods;
-  
+
   if (turbine_speed < 10.0) {
     turbine_speed = 0.0;
-    setMotorDirection(4, MOTOR_STOP);
-  } else {
-    setMotorDirection(4, MOTOR_FORWARD);
   }
-  
+}
+
+void applyTurbineOutputs() {
+  int dir = (turbine_speed < 10.0) ? MOTOR_STOP : MOTOR_FORWARD;
+  if (dir != out_turbine_dir) {
+    setMotorDirection(4, dir);
+    out_turbine_dir = dir;
+  }
+
   int pwm_turbine = map((int)turbine_speed, 0, 100, 0, 255);
-  ledcWrite(MOTOR_TURBINE, pwm_turbine);
+  if (pwm_turbine != out_pwm_turbine) {
+    ledcWrite(MOTOR_TURBINE, pwm_turbine);
+    out_pwm_turbine = pwm_turbine;
+  }
 }
@@ -32,23 +32,23 @@
  */
 
 #include <Arduino.h>
-#include <SPI.h>
+#include <driver/spi_master.h>  // IDF SPI driver (DMA + queued transactions)
+#include <driver/gpio.h>
+#include <esp_timer.h>     // Microsecond timestamps for loop period stats
+#include <PLTNProtocol.h>  // Shared codec (framing, table-driven CRC8, packed structs)
+
+using namespace pltn;
 
 // ============================================
-// Binary Protocol Constants
+// Binary Protocol (see esp_common/PLTNProtocol)
 // ============================================
-#define STX 0x02          // Start of Text
-#define ETX 0x03          // End of Text
-#define ACK 0x06          // Acknowledge
-#define NACK 0x15         // Negative Acknowledge
-#define CMD_PING 0x50     // 'P' - Ping command
-#define CMD_UPDATE 0x55   // 'U' - Update command
-
-// Message lengths
-#define PING_CMD_LEN 5    // [STX][CMD][LEN=0][CRC][ETX]
-#define UPDATE_CMD_LEN 12 // [STX][CMD][LEN=7][thermal_kw (4)][pump_prim][pump_sec][pump_ter][CRC][ETX]
-#define PING_RESP_LEN 5   // [STX][ACK][LEN=0][CRC][ETX]
-#define UPDATE_RESP_LEN 13 // [STX][ACK][LEN=8][power_mwe (4)][pwm][pump_prim][pump_sec][pump_ter][CRC][ETX]
+// Constants (STX/ETX/ACK/NACK, CMD_*) and CRC8 come from PLTNProtocol.h.
+// Message lengths:
+// - Ping command:    5 bytes  [STX][CMD][LEN=0][CRC][ETX]
+// - Update command: 12 bytes  [STX][CMD][LEN=7][EspECommand][CRC][ETX]
+// - Stats command:   5 bytes  [STX][CMD][LEN=0][CRC][ETX]
+// - Update response:13 bytes  [STX][ACK][LEN=8][EspEResponse][CRC][ETX]
+// - Stats response: 37 bytes  [STX][ACK][LEN=32][EspStats][CRC][ETX]
 
 // ============================================
 // PUMP STRUCT
@@ -90,6 +90,16 @@ const int POWER_LEDS[NUM_LEDS] = {25, 26, 27, 32};  // GPIO aman, tidak konflik
 */
 uint8_t sr_data[NUM_IC];
 
+// DMA double-buffering: frames are queued on the SPI driver and clocked
+// out by DMA in the background, the latch fires from the transfer-done
+// callback. The loop never blocks on SPI.transfer anymore - a UART frame
+// arriving mid-animation step is serviced immediately.
+spi_device_handle_t sr_spi = nullptr;
+DMA_ATTR uint8_t sr_dma_buf[2][NUM_IC];   // DMA-capable TX buffers
+spi_transaction_t sr_trans[2];
+int sr_buf_next = 0;                      // Buffer to fill for the next frame
+volatile bool sr_trans_inflight = false;
+
 // Ring pattern for each IC (2 LEDs active, circular rotation)
 uint8_t ring_pattern[NUM_IC] = {
   0b00000011,  // IC #1
@@ -108,24 +118,6 @@ uint8_t ring_pattern[NUM_IC] = {
 // Animation timer
 unsigned long lastAnimTime = 0;
 
-// ============================================
-// CRC8 Checksum (CRC-8/MAXIM)
-// ============================================
-uint8_t crc8_maxim(const uint8_t* data, size_t len) {
-  uint8_t crc = 0x00;
-  for (size_t i = 0; i < len; i++) {
-    crc ^= data[i];
-    for (uint8_t j = 0; j < 8; j++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x31;
-      } else {
-        crc = crc << 1;
-      }
-    }
-  }
-  return crc;
-}
-
 // ============================================
 // UART Configuration
 // ============================================
@@ -146,6 +138,11 @@ RxState rx_state = WAIT_STX;
 unsigned long last_byte_time = 0;
 #define RX_TIMEOUT_MS 500
 
+// High-baud negotiation: setelah switch CMD_SET_BAUD, link baru harus
+// dikonfirmasi frame valid (Pi langsung ping). Kalau deadline lewat
+// tanpa konfirmasi, kembali ke BAUD_DEFAULT.
+unsigned long baud_confirm_deadline = 0;  // 0 = tidak ada switch pending
+
 // ============================================
 // DATA VARIABLES
 // ============================================
@@ -165,6 +162,12 @@ Pump pump_tertiary = {0, 0};
 #define PWM_THRESHOLD_LOW 240
 bool led_mode_high = false;
 
+// Hardware fade engine: loop hanya set target, LEDC hardware yang
+// menjalankan ramp. 4 ms/step sama dengan ramp software lama (5 step
+// per 20ms interval).
+#define LED_FADE_MS_PER_STEP 4
+int led_fade_target = -1;  // Target fade yang sedang berjalan (-1 = none)
+
 // ============================================
 // SHIFT REGISTER FUNCTIONS (SPI HARDWARE)
 // ============================================
@@ -205,155 +208,231 @@ void updateSRBuffer() {
 }
 
 /**
- * Write data to shift registers via SPI hardware
+ * SPI transfer-done callback (ISR context): pulse RCLK so the frame
+ * that just finished shifting gets latched to the outputs
+ */
+void IRAM_ATTR srPostTransferCallback(spi_transaction_t* t) {
+  gpio_set_level((gpio_num_t)LATCH_PIN_GLOBAL, 0);
+  gpio_set_level((gpio_num_t)LATCH_PIN_GLOBAL, 1);
+  sr_trans_inflight = false;
+}
+
+/**
+ * Queue the current sr_data frame on the SPI driver (non-blocking).
+ * DMA clocks it out in the background; the callback latches it.
  */
 void shiftRegisterWrite() {
-  digitalWrite(LATCH_PIN_GLOBAL, LOW);
-  
-  // Send data from last IC to first IC
-  for (int i = NUM_IC - 1; i >= 0; i--) {
-    SPI.transfer(sr_data[i]);
+  if (sr_trans_inflight) {
+    // Previous 24-bit frame still on the wire (takes ~24us at 1MHz,
+    // so this only happens if called back-to-back) - skip this frame,
+    // the next animation step sends fresh data anyway
+    return;
   }
-  
-  digitalWrite(LATCH_PIN_GLOBAL, HIGH);
-  
+
+  // Fill the inactive buffer: data goes out last IC first
+  uint8_t* buf = sr_dma_buf[sr_buf_next];
+  for (int i = 0; i < NUM_IC; i++) {
+    buf[i] = sr_data[NUM_IC - 1 - i];
+  }
+
+  spi_transaction_t* t = &sr_trans[sr_buf_next];
+  memset(t, 0, sizeof(spi_transaction_t));
+  t->length = NUM_IC * 8;  // Bits
+  t->tx_buffer = buf;
+
+  sr_trans_inflight = true;
+  sr_buf_next ^= 1;
+  if (spi_device_queue_trans(sr_spi, t, 0) != ESP_OK) {
+    sr_trans_inflight = false;
+  }
+
   #if DEBUG_SHIFT_REGISTER
-    Serial.printf("[SR] IC1=0x%02X IC2=0x%02X IC3=0x%02X\n", 
+    Serial.printf("[SR] IC1=0x%02X IC2=0x%02X IC3=0x%02X\n",
                   sr_data[0], sr_data[1], sr_data[2]);
   #endif
 }
 
 
 
+// ============================================
+// Performance Counters (CMD_STATS)
+// ============================================
+// Counter murah yang bisa dibaca Pi lewat CMD_STATS - debug serial USB
+// tidak terjangkau di cabinet terpasang. Event counter kumulatif sejak
+// boot; window periode loop (min/max/mean) reset setiap dibaca.
+uint32_t stats_frames_received = 0;
+uint32_t stats_crc_failures = 0;
+uint32_t stats_nacks_sent = 0;
+uint32_t stats_frame_overflows = 0;
+uint32_t stats_led_updates = 0;        // LED fade start / mode switch
+uint32_t stats_loop_min_us = UINT32_MAX;
+uint32_t stats_loop_max_us = 0;
+uint32_t stats_loop_sum_us = 0;
+uint32_t stats_loop_count = 0;
+
+void recordLoopPeriod(uint32_t period_us) {
+  if (period_us < stats_loop_min_us) stats_loop_min_us = period_us;
+  if (period_us > stats_loop_max_us) stats_loop_max_us = period_us;
+  // Jaga akumulator mean kalau stats tidak pernah dibaca
+  if (stats_loop_sum_us > 0xF0000000UL) {
+    stats_loop_sum_us = 0;
+    stats_loop_count = 0;
+  }
+  stats_loop_sum_us += period_us;
+  stats_loop_count++;
+}
+
 // ============================================
 // BINARY PROTOCOL FUNCTIONS
 // ============================================
 
 void sendNACK() {
-  uint8_t response[5];
-  response[0] = STX;
-  response[1] = NACK;
-  response[2] = 0;
-  
-  uint8_t crc_data[2] = {NACK, 0};
-  response[3] = crc8_maxim(crc_data, 2);
-  response[4] = ETX;
-  
-  UartComm.write(response, 5);
+  uint8_t response[FRAME_OVERHEAD];
+  size_t len = encode_empty_frame(response, NACK);
+
+  UartComm.write(response, len);
   UartComm.flush();  // CRITICAL: Ensure data is sent before continuing
-  
+
+  stats_nacks_sent++;
+
   #if DEBUG_UART
     Serial.println("TX: NACK");
   #endif
 }
 
 void sendPongResponse() {
-  uint8_t response[5];
-  response[0] = STX;
-  response[1] = ACK;
-  response[2] = 0;
-  
-  uint8_t crc_data[2] = {ACK, 0};
-  response[3] = crc8_maxim(crc_data, 2);
-  response[4] = ETX;
-  
-  UartComm.write(response, 5);
+  uint8_t response[FRAME_OVERHEAD];
+  size_t len = encode_empty_frame(response, ACK);
+
+  UartComm.write(response, len);
   UartComm.flush();  // CRITICAL: Ensure data is sent before continuing
-  
+
   #if DEBUG_UART
     Serial.println("TX: Pong ACK");
   #endif
 }
 
 void sendUpdateResponse() {
-  uint8_t response[13];
-  response[0] = STX;
-  response[1] = ACK;
-  response[2] = 8;
-  
-  uint8_t* data = &response[3];
-  memcpy(&data[0], &power_mwe, 4);
-  data[4] = (uint8_t)current_pwm;
-  data[5] = pump_primary.status;
-  data[6] = pump_secondary.status;
-  data[7] = pump_tertiary.status;
-  
-  response[11] = crc8_maxim(&response[1], 10);
-  response[12] = ETX;
-  
-  UartComm.write(response, 13);
+  EspEResponse resp;
+  resp.power_mwe = power_mwe;
+  resp.pwm = (uint8_t)current_pwm;
+  resp.pump_primary = pump_primary.status;
+  resp.pump_secondary = pump_secondary.status;
+  resp.pump_tertiary = pump_tertiary.status;
+
+  uint8_t response[sizeof(EspEResponse) + FRAME_OVERHEAD];
+  size_t len = encode_frame(response, ACK, resp);
+
+  UartComm.write(response, len);
   UartComm.flush();  // CRITICAL: Ensure data is sent before continuing
-  
+
   #if DEBUG_UART
     Serial.println("TX: Update ACK with data");
   #endif
 }
 
+void sendStatsResponse() {
+  // Kirim performance counter: [STX][ACK][LEN=32][EspStats][CRC][ETX]
+  EspStats stats;
+  stats.loop_period_min_us = (stats_loop_count > 0) ? stats_loop_min_us : 0;
+  stats.loop_period_max_us = stats_loop_max_us;
+  stats.loop_period_mean_us = (stats_loop_count > 0) ? stats_loop_sum_us / stats_loop_count : 0;
+  stats.frames_received = stats_frames_received;
+  stats.crc_failures = stats_crc_failures;
+  stats.nacks_sent = stats_nacks_sent;
+  stats.buffer_overflows = stats_frame_overflows;
+  stats.actuator_updates = stats_led_updates;
+
+  // Reset window periode loop - laporan berikutnya mulai dari sini
+  stats_loop_min_us = UINT32_MAX;
+  stats_loop_max_us = 0;
+  stats_loop_sum_us = 0;
+  stats_loop_count = 0;
+
+  uint8_t response[sizeof(EspStats) + FRAME_OVERHEAD];
+  size_t len = encode_frame(response, ACK, stats);
+
+  UartComm.write(response, len);
+  UartComm.flush();
+
+  #if DEBUG_UART
+    Serial.println("TX: Stats");
+  #endif
+}
+
 void processBinaryMessage(uint8_t* msg, uint8_t len) {
-  // Validasi struktur pesan
-  if (len < 5 || msg[0] != STX || msg[len-1] != ETX) {
+  // Validasi frame (struktur, panjang, CRC) - zero-copy view ke RX buffer
+  FrameView frame = decode_frame(msg, len);
+  if (!frame.valid) {
+    stats_crc_failures++;
     sendNACK();
     return;
   }
-  
-  uint8_t cmd = msg[1];
-  uint8_t payload_len = msg[2];
-  uint8_t received_crc = msg[len-2];
-  
-  // Validasi panjang
-  uint8_t expected_len = 5 + payload_len;
-  if (len != expected_len) {
-    sendNACK();
-    return;
-  }
-  
-  // Validasi CRC
-  uint8_t crc_len = 2 + payload_len;
-  uint8_t calculated_crc = crc8_maxim(&msg[1], crc_len);
-  
-  if (received_crc != calculated_crc) {
-    sendNACK();
-    return;
-  }
-  
+
+  stats_frames_received++;
+
+  // Frame valid apapun mengonfirmasi baud switch yang pending
+  baud_confirm_deadline = 0;
+
   // Process command
-  if (cmd == CMD_PING) {
-    if (payload_len != 0) {
+  if (frame.cmd == CMD_PING) {
+    if (frame.len != 0) {
       sendNACK();
       return;
     }
-    
+
     #if DEBUG_UART
       Serial.println("RX: Ping");
     #endif
-    
+
     sendPongResponse();
   }
-  else if (cmd == CMD_UPDATE) {
-    if (payload_len != 7) {
+  else if (frame.cmd == CMD_UPDATE) {
+    const EspECommand* update = payload_as<EspECommand>(frame);
+    if (update == nullptr) {
       sendNACK();
       return;
     }
-    
+
     pump_primary.lastStatus = pump_primary.status;
     pump_secondary.lastStatus = pump_secondary.status;
     pump_tertiary.lastStatus = pump_tertiary.status;
-    // Parse data
-    memcpy(&thermal_kw, &msg[3], 4);
-    pump_primary.status = msg[7];
-    pump_secondary.status = msg[8];
-    pump_tertiary.status = msg[9];
-    
+    // Parse data (zero-copy view)
+    thermal_kw = update->thermal_kw;
+    pump_primary.status = update->pump_primary;
+    pump_secondary.status = update->pump_secondary;
+    pump_tertiary.status = update->pump_tertiary;
+
     // Convert kW to MWe
     power_mwe = thermal_kw / 1000.0;
-    
+
     #if DEBUG_UART
-      Serial.printf("RX: Update - Thermal=%.1f kW → Power=%.1f MWe\n", 
+      Serial.printf("RX: Update - Thermal=%.1f kW → Power=%.1f MWe\n",
                     thermal_kw, power_mwe);
     #endif
-    
+
     sendUpdateResponse();
   }
+  else if (frame.cmd == CMD_SET_BAUD) {
+    const SetBaudCommand* setbaud = payload_as<SetBaudCommand>(frame);
+    if (setbaud == nullptr || !baud_allowed(setbaud->baud)) {
+      sendNACK();
+      return;
+    }
+
+    // ACK dulu di rate lama (sendPongResponse flush), baru switch.
+    // Kalau Pi tidak pernah sampai di rate baru, deadline revert.
+    sendPongResponse();
+    UartComm.updateBaudRate(setbaud->baud);
+    baud_confirm_deadline = millis() + BAUD_CONFIRM_TIMEOUT_MS;
+  }
+  else if (frame.cmd == CMD_STATS) {
+    if (frame.len != 0) {
+      sendNACK();
+      return;
+    }
+    sendStatsResponse();
+  }
   else {
     sendNACK();
   }
@@ -403,6 +482,7 @@ void processUART() {
       }
       else {
         // Buffer overflow
+        stats_frame_overflows++;
         rx_state = WAIT_STX;
         rx_index = 0;
       }
@@ -419,23 +499,24 @@ void processUART() {
 void updatePowerLED() {
   // Calculate PWM based on power output
   int target_pwm = 0;
-  
+
   if (power_mwe > 0) {
     target_pwm = map(power_mwe, 0, 300, 0, 255);
     target_pwm = constrain(target_pwm, 0, 255);
-    
+
     if (target_pwm < 20) {
       target_pwm = 20;
     }
   }
-  
-  // Smooth transition
-  if (target_pwm > current_pwm) {
-    current_pwm += min(5, target_pwm - current_pwm);
-  } else if (target_pwm < current_pwm) {
-    current_pwm -= min(5, current_pwm - target_pwm);
+
+  // Ramp dijalankan hardware fade engine - di sini cukup baca posisi
+  // duty saat ini untuk telemetry dan hysteresis check
+  if (led_mode_high) {
+    current_pwm = 255;
+  } else {
+    current_pwm = (int)ledcRead(POWER_LEDS[0]);
   }
-  
+
   // Mode switching dengan hysteresis
   if (!led_mode_high && current_pwm >= PWM_THRESHOLD_HIGH) {
     // Switch ke HIGH mode
@@ -445,38 +526,48 @@ void updatePowerLED() {
       digitalWrite(POWER_LEDS[i], HIGH);
     }
     led_mode_high = true;
-    
+    led_fade_target = -1;
+    stats_led_updates++;
+
     #if DEBUG_TIMING
       Serial.println("LED Mode: HIGH (full brightness)");
     #endif
   }
-  else if (led_mode_high && current_pwm < PWM_THRESHOLD_LOW) {
-    // Switch kembali ke PWM mode
+  else if (led_mode_high && target_pwm < PWM_THRESHOLD_LOW) {
+    // Switch kembali ke PWM mode, fade turun dari full brightness
     for (int i = 0; i < NUM_LEDS; i++) {
       ledcAttach(POWER_LEDS[i], 5000, 8);
-      ledcWrite(POWER_LEDS[i], current_pwm);
+      ledcWrite(POWER_LEDS[i], 255);
+      ledcFade(POWER_LEDS[i], 255, target_pwm,
+               (255 - target_pwm) * LED_FADE_MS_PER_STEP);
     }
     led_mode_high = false;
-    
+    led_fade_target = target_pwm;
+    stats_led_updates++;
+
     #if DEBUG_TIMING
       Serial.println("LED Mode: PWM");
     #endif
   }
-  // Update PWM jika dalam mode PWM
-  else if (!led_mode_high) {
+  // Start fade hardware baru hanya saat target berubah
+  else if (!led_mode_high && target_pwm != led_fade_target) {
+    int fade_ms = abs(target_pwm - current_pwm) * LED_FADE_MS_PER_STEP;
+    if (fade_ms < 1) fade_ms = 1;
     for (int i = 0; i < NUM_LEDS; i++) {
-      ledcWrite(POWER_LEDS[i], current_pwm);
+      ledcFade(POWER_LEDS[i], current_pwm, target_pwm, fade_ms);
     }
+    led_fade_target = target_pwm;
+    stats_led_updates++;
   }
   // HIGH mode: LEDs tetap HIGH, tidak perlu update
-  
+
   // Debug output
   static unsigned long last_debug = 0;
   #if DEBUG_TIMING
     if (millis() - last_debug > DEBUG_INTERVAL) {
       last_debug = millis();
       const char* mode_str = led_mode_high ? "HIGH" : "PWM";
-      Serial.printf("Power: %.1f MWe | PWM: %d | Mode: %s\n", 
+      Serial.printf("Power: %.1f MWe | PWM: %d | Mode: %s\n",
                     power_mwe, current_pwm, mode_str);
     }
   #endif
@@ -509,10 +600,24 @@ void setup() {
   digitalWrite(LATCH_PIN_GLOBAL, HIGH);
   Serial.println("✓ LATCH pin initialized (GPIO 5)");
   
-  // Initialize SPI Hardware
-  SPI.begin(SPI_CLOCK_PIN, -1, SPI_MOSI_PIN, -1);
-  SPI.beginTransaction(SPISettings(1000000, MSBFIRST, SPI_MODE0));
-  Serial.println("✓ SPI Hardware initialized (1MHz, MSBFIRST, MODE0)");
+  // Initialize SPI Hardware via IDF driver (DMA, queued transactions)
+  spi_bus_config_t buscfg = {};
+  buscfg.mosi_io_num = SPI_MOSI_PIN;
+  buscfg.miso_io_num = -1;
+  buscfg.sclk_io_num = SPI_CLOCK_PIN;
+  buscfg.quadwp_io_num = -1;
+  buscfg.quadhd_io_num = -1;
+  buscfg.max_transfer_sz = 32;
+  spi_bus_initialize(SPI2_HOST, &buscfg, SPI_DMA_CH_AUTO);
+
+  spi_device_interface_config_t devcfg = {};
+  devcfg.clock_speed_hz = 1000000;  // 1MHz, MODE0, MSBFIRST (driver default)
+  devcfg.mode = 0;
+  devcfg.spics_io_num = -1;         // Latch digerakkan manual dari callback
+  devcfg.queue_size = 2;            // Double-buffered
+  devcfg.post_cb = srPostTransferCallback;
+  spi_bus_add_device(SPI2_HOST, &devcfg, &sr_spi);
+  Serial.println("✓ SPI Hardware initialized (1MHz, DMA double-buffered)");
   
   delay(10);
   
@@ -563,7 +668,15 @@ void setup() {
 void loop() {
   static unsigned long last_led_time = 0;
   static unsigned long last_uart_time = 0;
-  
+  static int64_t last_tick_us = 0;
+
+  // Statistik periode loop (dibaca Pi lewat CMD_STATS)
+  int64_t tick_us = esp_timer_get_time();
+  if (last_tick_us != 0) {
+    recordLoopPeriod((uint32_t)(tick_us - last_tick_us));
+  }
+  last_tick_us = tick_us;
+
   unsigned long current_time = millis();
   
   // 1. Update ring animation at fixed interval
@@ -593,6 +706,12 @@ void loop() {
     processUART();
     last_uart_time = current_time;
   }
+
+  // 4. Revert baud switch yang tidak terkonfirmasi
+  if (baud_confirm_deadline != 0 && current_time > baud_confirm_deadline) {
+    UartComm.updateBaudRate(BAUD_DEFAULT);
+    baud_confirm_deadline = 0;
+  }
   
   // Yield untuk menjaga stabilitas sistem
   yield();
@@ -4,11 +4,14 @@ Menampilkan video edukasi atau interactive guide
 Fullscreen ke HDMI monitor
 
 TESTING MODE: Run standalone tanpa simulasi backend
-PRODUCTION MODE: Read state dari /tmp/pltn_state.json
+PRODUCTION MODE: Read state dari shared memory (/dev/shm/pltn_state.bin),
+                 fallback ke /tmp/pltn_state.json
 """
 
 import pygame
 import json
+import os
+import socket
 import time
 import sys
 import subprocess
@@ -17,6 +20,16 @@ from enum import Enum
 from typing import Optional, Dict
 import argparse
 
+# Shared-memory state channel (written by raspi_main_panel.py) - much
+# cheaper than re-parsing the JSON file every frame. Optional: falls
+# back to the JSON file if the module or the channel is unavailable.
+try:
+    sys.path.insert(0, str(Path(__file__).parent.parent / "raspi_central_control"))
+    from raspi_state_shm import StateShmReader
+    SHM_AVAILABLE = True
+except ImportError:
+    SHM_AVAILABLE = False
+
 # Fix Windows console encoding untuk emoji support
 if sys.platform == 'win32':
     import io
@@ -88,6 +101,148 @@ LEVEL_BUTTONS = {
 
 
 
+# Hardware decode chain for the Pi: prefer the V4L2 M2M stateful decoder
+# (zero-copy DRM-PRIME frames straight into the gpu vo), fall back to the
+# copy variant, then to mpv's safe autodetect on non-Pi machines.
+MPV_HWDEC_CHAIN = 'v4l2m2m,v4l2m2m-copy,auto-safe'
+
+# Wayland environment for the mpv subprocess (kiosk session on the Pi)
+MPV_ENV = {
+    'DISPLAY': ':0',
+    'WAYLAND_DISPLAY': 'wayland-0',
+    'XDG_RUNTIME_DIR': '/run/user/1000'
+}
+
+
+class MpvPrewarmPlayer:
+    """
+    Persistent mpv instance controlled over its JSON IPC socket
+
+    Spawning a fresh mpv per playback meant every transition into
+    DisplayMode.AUTO_VIDEO paid for process startup, GPU context init and
+    the demuxer probe - a visible stall before the first frame. Instead
+    one mpv process is started once at app init with the intro video
+    loaded and PAUSED at frame 0 in a minimized window: the demuxer, the
+    V4L2 M2M hardware decoder and the GPU context are all warm and the
+    first seconds are already demuxed into mpv's readahead buffer.
+    Starting playback is then three IPC property writes (restore window,
+    fullscreen, unpause) - effectively instant. Stopping rewinds to
+    frame 0 and re-minimizes, so the NEXT transition is just as fast.
+
+    Raises FileNotFoundError from start() if mpv is not installed -
+    caller should fall back to the one-shot subprocess path.
+    """
+
+    # Seconds of video kept demuxed ahead of the (paused) playhead
+    READAHEAD_SECS = 5
+
+    def __init__(self, video_path: str, socket_path: str = '/tmp/pltn_mpv_ipc.sock'):
+        self.video_path = video_path
+        self.socket_path = socket_path
+        self.process = None
+        self._sock = None
+
+    def start(self):
+        """Spawn mpv paused + minimized and wait for the IPC socket"""
+        # Stale socket from a previous run would confuse the wait loop
+        try:
+            os.unlink(self.socket_path)
+        except OSError:
+            pass
+
+        cmd = [
+            'mpv',
+            f'--input-ipc-server={self.socket_path}',
+            '--pause',                  # Hold at frame 0 until play()
+            '--window-minimized=yes',   # Hidden behind the pygame window
+            '--fs=no',
+            '--keep-open=always',       # Never exit at EOF - we rewind
+            '--loop-file=inf',
+            '--no-osd-bar',
+            '--no-input-default-bindings',
+            '--really-quiet',
+            '--vo=gpu',
+            f'--hwdec={MPV_HWDEC_CHAIN}',
+            '--gpu-context=wayland',
+            '--framedrop=vo',           # Drop late frames, never stall video
+            f'--demuxer-readahead-secs={self.READAHEAD_SECS}',
+            self.video_path
+        ]
+
+        self.process = subprocess.Popen(
+            cmd,
+            env=MPV_ENV,
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL
+        )
+
+        # mpv creates the socket once the player is up - poll briefly
+        deadline = time.time() + 5.0
+        while time.time() < deadline:
+            if os.path.exists(self.socket_path):
+                return
+            if self.process.poll() is not None:
+                raise FileNotFoundError("mpv exited during prewarm startup")
+            time.sleep(0.05)
+        raise FileNotFoundError("mpv IPC socket did not appear")
+
+    def alive(self) -> bool:
+        """True if the prewarm process is still running"""
+        return self.process is not None and self.process.poll() is None
+
+    def _send(self, *command):
+        """Send one command over the IPC socket (reconnects if needed)"""
+        payload = (json.dumps({"command": list(command)}) + '\n').encode()
+        for attempt in range(2):
+            try:
+                if self._sock is None:
+                    self._sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+                    self._sock.settimeout(1.0)
+                    self._sock.connect(self.socket_path)
+                self._sock.sendall(payload)
+                return
+            except OSError:
+                # Dead socket - drop it and retry once with a fresh connect
+                if self._sock:
+                    try:
+                        self._sock.close()
+                    except OSError:
+                        pass
+                    self._sock = None
+                if attempt == 1:
+                    raise
+
+    def play(self, loop: bool = True):
+        """Un-minimize, go fullscreen and start playback (instant)"""
+        self._send("set_property", "loop-file", "inf" if loop else "no")
+        self._send("set_property", "window-minimized", False)
+        self._send("set_property", "fullscreen", True)
+        self._send("set_property", "pause", False)
+
+    def rewind_and_hide(self):
+        """Pause, rewind to frame 0 and re-minimize - ready for next play()"""
+        self._send("set_property", "pause", True)
+        self._send("seek", 0, "absolute")
+        self._send("set_property", "fullscreen", False)
+        self._send("set_property", "window-minimized", True)
+
+    def shutdown(self):
+        """Quit the mpv process and release the socket"""
+        if self._sock:
+            try:
+                self._send("quit")
+                self._sock.close()
+            except OSError:
+                pass
+            self._sock = None
+        if self.process:
+            try:
+                self.process.wait(timeout=2)
+            except subprocess.TimeoutExpired:
+                self.process.kill()
+            self.process = None
+
+
 class VideoDisplayApp:
     """
     Video Display Application for PLTN Simulator
@@ -133,12 +288,37 @@ class VideoDisplayApp:
         else:
             # Linux/RPi: use /tmp
             self.state_file = Path("/tmp/pltn_state.json")
-        
+
         self.last_state = {}
+
+        # State ingestion: prefer the shared-memory channel (single
+        # memcpy per read), fall back to the JSON file. The JSON path is
+        # change-gated on the file's mtime so the 30fps update loop never
+        # re-parses a document that hasn't changed - between changes the
+        # cached last-good snapshot is returned.
+        self.shm_reader = StateShmReader() if (SHM_AVAILABLE and sys.platform != 'win32') else None
+        self._cached_state = {}
+        self._state_file_mtime = None
         
         # Video player (mpv subprocess)
         self.video_process = None
         self.current_video = None
+
+        # Pre-warmed mpv for the intro video: decoder + demuxer spun up
+        # once at init so the AUTO_VIDEO transition starts instantly.
+        # Skipped in test mode and on Windows (no Wayland / unix socket).
+        self.prewarm_player = None
+        self._prewarm_active = False  # True while the prewarm mpv is fullscreen
+        if not test_mode and sys.platform != 'win32':
+            intro_path = Path(__file__).parent / "assets" / "penjelasan.mp4"
+            if intro_path.exists():
+                try:
+                    self.prewarm_player = MpvPrewarmPlayer(str(intro_path))
+                    self.prewarm_player.start()
+                    print(f"🎞️  Prewarmed mpv ready (hwdec={MPV_HWDEC_CHAIN})")
+                except (FileNotFoundError, OSError) as e:
+                    print(f"⚠️  mpv prewarm unavailable ({e}) - will spawn per play")
+                    self.prewarm_player = None
         
         # Display mode
         self.display_mode = DisplayMode.IDLE
@@ -203,6 +383,22 @@ class VideoDisplayApp:
         self.idle_fade_alpha = 255
         self.idle_fade_direction = -1
         self.idle_fade_speed = 2
+
+        # Render cache: font rasterization is the most expensive pygame
+        # call in the draw path, and almost every label is static or
+        # slow-changing. render_text() memoizes surfaces on
+        # (text, font, color); the idle layout is additionally
+        # pre-rendered once into a full-screen surface so the 30fps loop
+        # only touches the fading instruction strip (dirty-rect update
+        # instead of a full flip).
+        self._text_cache = {}
+        self._idle_static = None       # Pre-rendered IDLE layout
+        self._idle_inst_rect = None    # Strip the fading instruction lives in
+        self._last_drawn_mode = None   # 'idle' / 'guide' - forces full repaint on change
+        self._guide_layout_sig = None  # (warning level, step) of last full guide paint
+        self._guide_bar_values = None  # Bar values at last bars repaint
+        self._guide_params_y_start = 0
+        self._guide_bars_rect = None
         
         # Mode transition tracking
         self.last_state_hash = None  # Track state changes
@@ -247,7 +443,10 @@ class VideoDisplayApp:
 
         else:
             print("🚀 PRODUCTION MODE")
-            print(f"   Reading state from: {self.state_file}")
+            if self.shm_reader:
+                print(f"   Reading state from: shared memory (fallback: {self.state_file})")
+            else:
+                print(f"   Reading state from: {self.state_file}")
         
         print(f"🎬 Video Display App initialized")
         print(f"   Screen: {self.width}x{self.height}")
@@ -284,6 +483,24 @@ class VideoDisplayApp:
             self.logo_brin = None
             self.logo_poltek = None
     
+    def render_text(self, font, text: str, color) -> pygame.Surface:
+        """
+        Cached font.render - returns the same surface for repeated
+        (text, font, color) triples instead of re-rasterizing every frame
+
+        Value labels like "140bar" have bounded cardinality, so the cache
+        stays small; it is cleared defensively if it ever grows past 1024
+        entries.
+        """
+        key = (text, id(font), color)
+        surf = self._text_cache.get(key)
+        if surf is None:
+            if len(self._text_cache) > 1024:
+                self._text_cache.clear()
+            surf = font.render(text, True, color)
+            self._text_cache[key] = surf
+        return surf
+
     def create_mock_state(self) -> Dict:
         """Create mock state for testing"""
         return {
@@ -307,7 +524,8 @@ class VideoDisplayApp:
         """
         Read state from backend simulation
         In test mode: return mock state
-        In production: read from JSON file
+        In production: shared-memory channel, fallback to JSON file
+        (change-gated - cached snapshot returned between updates)
         """
         if self.test_mode:
             # Update mock state based on current mode
@@ -324,14 +542,31 @@ class VideoDisplayApp:
             
             return self.mock_state
         
-        # Production mode: read from file
+        # Production mode: shared memory first, JSON file as fallback
         try:
-            if not self.state_file.exists():
+            state = None
+
+            if self.shm_reader:
+                state = self.shm_reader.read()
+
+            if state is None:
+                # JSON fallback - only re-parse when the file actually
+                # changed (mtime check), otherwise reuse cached snapshot
+                try:
+                    mtime = os.stat(self.state_file).st_mtime_ns
+                except OSError:
+                    return {}
+
+                if mtime != self._state_file_mtime:
+                    with open(self.state_file, 'r') as f:
+                        self._cached_state = json.load(f)
+                    self._state_file_mtime = mtime
+
+                state = self._cached_state
+
+            if not state:
                 return {}
-            
-            with open(self.state_file, 'r') as f:
-                state = json.load(f)
-            
+
             # Check if state has changed significantly (user interaction)
             if not self.user_has_interacted:
                 current_pressure = state.get("pressure", 0)
@@ -482,15 +717,18 @@ class VideoDisplayApp:
     def play_video(self, video_path: str, loop: bool = False):
         """
         Play video using mpv (Wayland compatible)
-        
+
+        Uses the pre-warmed mpv instance for the intro video (instant
+        start via IPC), one-shot subprocess for anything else.
+
         Args:
             video_path: Path to video file
             loop: Loop video infinitely
         """
         # Stop any current video
-        if self.video_process:
+        if self.video_process or self._prewarm_active:
             self.stop_video()
-        
+
         # Check if video file exists
         if not Path(video_path).exists():
             print(f"❌ Video not found: {video_path}")
@@ -498,7 +736,21 @@ class VideoDisplayApp:
                 print("   💡 In test mode, this is expected")
                 print("   💡 Create video file or use placeholder")
             return
-        
+
+        # Fast path: pre-warmed instance already holds this file paused
+        # at frame 0 - no process spawn, no demuxer startup
+        if (self.prewarm_player and self.prewarm_player.alive()
+                and self.prewarm_player.video_path == video_path):
+            try:
+                self.prewarm_player.play(loop=loop)
+                self._prewarm_active = True
+                self.current_video = video_path
+                print(f"▶️  Playing (prewarmed): {Path(video_path).name}")
+                return
+            except OSError as e:
+                print(f"⚠️  Prewarm IPC failed ({e}) - falling back to spawn")
+                self._prewarm_active = False
+
         # Build mpv command for Wayland
         cmd = [
             'mpv',
@@ -507,25 +759,19 @@ class VideoDisplayApp:
             '--no-input-default-bindings',  # Disable keyboard
             '--really-quiet',           # Minimal output
             '--vo=gpu',                 # Video output: GPU (Wayland compatible)
-            '--hwdec=auto',             # Hardware decode (4K support)
+            f'--hwdec={MPV_HWDEC_CHAIN}',  # V4L2 M2M hardware decode, zero-copy when possible
             '--gpu-context=wayland',    # Use Wayland context
+            '--framedrop=vo',           # Drop late frames instead of stalling
             video_path
         ]
-        
+
         if loop:
             cmd.insert(1, '--loop=inf')
-        
+
         try:
-            # Set Wayland environment for mpv
-            env = {
-                'DISPLAY': ':0',
-                'WAYLAND_DISPLAY': 'wayland-0',
-                'XDG_RUNTIME_DIR': '/run/user/1000'
-            }
-            
             self.video_process = subprocess.Popen(
                 cmd,
-                env=env,
+                env=MPV_ENV,
                 stdout=subprocess.DEVNULL,
                 stderr=subprocess.DEVNULL
             )
@@ -539,9 +785,24 @@ class VideoDisplayApp:
                 print("   💡 Test mode: Simulating video playback")
         except Exception as e:
             print(f"❌ Failed to play video: {e}")
-    
+
     def stop_video(self):
         """Stop current video"""
+        # Any mode transition goes through here - force the next draw to
+        # do a full repaint instead of a dirty-rect fast path
+        self._last_drawn_mode = None
+        if self._prewarm_active:
+            # Don't kill the prewarmed instance - rewind and hide it so
+            # the next transition into video is instant again
+            try:
+                self.prewarm_player.rewind_and_hide()
+            except OSError as e:
+                print(f"⚠️  Prewarm IPC failed on stop ({e})")
+                self.prewarm_player.shutdown()
+                self.prewarm_player = None
+            self._prewarm_active = False
+            self.current_video = None
+            print("⏹️  Video stopped (prewarm re-armed)")
         if self.video_process:
             self.video_process.terminate()
             try:
@@ -552,141 +813,212 @@ class VideoDisplayApp:
             self.current_video = None
             print("⏹️  Video stopped")
     
-    def draw_idle_screen(self):
-        """Display idle/intro screen - Optimized for 4K display"""
-        self.screen.fill(self.COLOR_BG)
-        
-        # Update fade animation for instruction text
-        self.idle_fade_alpha += self.idle_fade_direction * self.idle_fade_speed
-        if self.idle_fade_alpha >= 255:
-            self.idle_fade_alpha = 255
-            self.idle_fade_direction = -1
-        elif self.idle_fade_alpha <= 180:
-            self.idle_fade_alpha = 180
-            self.idle_fade_direction = 1
-        
+    def _build_idle_static(self):
+        """
+        Pre-render the static IDLE layout into a cached surface
+
+        Everything on the idle screen except the fading instruction line
+        is immutable, so it is drawn exactly once here; draw_idle_screen
+        then only re-blits the instruction strip each frame.
+        """
+        surf = pygame.Surface((self.width, self.height))
+        surf.fill(self.COLOR_BG)
+
         # === TOP SECTION: LOGOS === (larger, more prominent)
         logo_y = int(80 * self.scale)  # Increased from 50
         logo_margin = int(100 * self.scale)  # Increased from 80
-        
+
         # BRIN Logo (Top Left)
         if self.logo_brin:
             logo_x = logo_margin
-            self.screen.blit(self.logo_brin, (logo_x, logo_y))
-        
+            surf.blit(self.logo_brin, (logo_x, logo_y))
+
         # Poltek Logo (Top Right)
         if self.logo_poltek:
             logo_x = self.width - self.logo_size_large[0] - logo_margin
-            self.screen.blit(self.logo_poltek, (logo_x, logo_y))
-        
+            surf.blit(self.logo_poltek, (logo_x, logo_y))
+
         # === CENTER SECTION: MAIN TITLE WITH DECORATIVE LINES ===
         center_y_start = self.height // 2 - int(180 * self.scale)  # Adjusted for larger content
-        
+
         # Decorative line (top) - much longer to use more width
         line_width = int(1200 * self.scale)  # Increased from 600 - use more screen width
         line_x = (self.width - line_width) // 2
         line_thickness = max(int(4 * self.scale), 3)  # Thicker
-        pygame.draw.line(self.screen, self.COLOR_BORDER, 
-                        (line_x, center_y_start - int(30 * self.scale)), 
-                        (line_x + line_width, center_y_start - int(30 * self.scale)), 
+        pygame.draw.line(surf, self.COLOR_BORDER,
+                        (line_x, center_y_start - int(30 * self.scale)),
+                        (line_x + line_width, center_y_start - int(30 * self.scale)),
                         line_thickness)
-        
+
         # Main Title Line 1 (Bright Cyan with shadow)
         title1_text = "ALAT PERAGA PLTN TIPE PWR"
         # Shadow (larger offset for 4K)
-        title1_shadow = self.font_display.render(title1_text, True, (0, 0, 0))
+        title1_shadow = self.render_text(self.font_display, title1_text, (0, 0, 0))
         shadow_offset = int(4 * self.scale)  # Increased from 2
         title1_shadow_rect = title1_shadow.get_rect(center=(self.width//2 + shadow_offset, center_y_start + int(32 * self.scale)))
-        self.screen.blit(title1_shadow, title1_shadow_rect)
+        surf.blit(title1_shadow, title1_shadow_rect)
         # Main text
-        title1 = self.font_display.render(title1_text, True, self.COLOR_PRIMARY_BRIGHT)
+        title1 = self.render_text(self.font_display, title1_text, self.COLOR_PRIMARY_BRIGHT)
         title1_rect = title1.get_rect(center=(self.width//2, center_y_start + int(30 * self.scale)))
-        self.screen.blit(title1, title1_rect)
-        
+        surf.blit(title1, title1_rect)
+
         # Main Title Line 2 (Pure White)
         title2_text = "BERBASIS MIKROKONTROLER"
         # Shadow
-        title2_shadow = self.font_subtitle.render(title2_text, True, (0, 0, 0))
+        title2_shadow = self.render_text(self.font_subtitle, title2_text, (0, 0, 0))
         title2_shadow_rect = title2_shadow.get_rect(center=(self.width//2 + shadow_offset, center_y_start + int(122 * self.scale)))
-        self.screen.blit(title2_shadow, title2_shadow_rect)
+        surf.blit(title2_shadow, title2_shadow_rect)
         # Main text
-        title2 = self.font_subtitle.render(title2_text, True, self.COLOR_TEXT)
+        title2 = self.render_text(self.font_subtitle, title2_text, self.COLOR_TEXT)
         title2_rect = title2.get_rect(center=(self.width//2, center_y_start + int(120 * self.scale)))
-        self.screen.blit(title2, title2_rect)
-        
+        surf.blit(title2, title2_rect)
+
         # Decorative line (bottom)
-        pygame.draw.line(self.screen, self.COLOR_BORDER, 
-                        (line_x, center_y_start + int(190 * self.scale)), 
-                        (line_x + line_width, center_y_start + int(190 * self.scale)), 
+        pygame.draw.line(surf, self.COLOR_BORDER,
+                        (line_x, center_y_start + int(190 * self.scale)),
+                        (line_x + line_width, center_y_start + int(190 * self.scale)),
                         line_thickness)
-        
+
         # Institution Name (Light Blue, larger)
-        institution = self.font_heading.render("Politeknik Teknologi Nuklir Indonesia", 
-                                               True, self.COLOR_TEXT_TERTIARY)
+        institution = self.render_text(self.font_heading, "Politeknik Teknologi Nuklir Indonesia",
+                                       self.COLOR_TEXT_TERTIARY)
         inst_rect = institution.get_rect(center=(self.width//2, center_y_start + int(250 * self.scale)))
-        self.screen.blit(institution, inst_rect)
-        
+        surf.blit(institution, inst_rect)
+
         # === ADDITIONAL INFO SECTION === (NEW - fill empty space)
         info_y = center_y_start + int(330 * self.scale)
-        
+
         # Description text
         desc_lines = [
             "Simulator Interaktif untuk Pembelajaran",
             "Pembangkit Listrik Tenaga Nuklir (PLTN)",
             "dengan Teknologi Pressurized Water Reactor (PWR)"
         ]
-        
+
         for i, line in enumerate(desc_lines):
-            desc_text = self.font_body.render(line, True, self.COLOR_TEXT_SECONDARY)
+            desc_text = self.render_text(self.font_body, line, self.COLOR_TEXT_SECONDARY)
             desc_rect = desc_text.get_rect(center=(self.width//2, info_y + i * int(55 * self.scale)))
-            self.screen.blit(desc_text, desc_rect)
-        
+            surf.blit(desc_text, desc_rect)
+
         # === STATUS BADGE === (larger and more prominent)
         status_y = center_y_start + int(520 * self.scale)
-        
+
         # Status badge background - much wider
         badge_width = int(800 * self.scale)  # Increased from 420 - use more width
         badge_height = int(60 * self.scale)  # Increased from 40
         badge_x = (self.width - badge_width) // 2
         badge_radius = int(30 * self.scale)  # Increased from 20
         badge_rect = pygame.Rect(badge_x, status_y - int(15 * self.scale), badge_width, badge_height)
-        pygame.draw.rect(self.screen, self.COLOR_BG_TERTIARY, badge_rect, border_radius=badge_radius)
-        pygame.draw.rect(self.screen, self.COLOR_GOLD, badge_rect, max(int(3 * self.scale), 2), border_radius=badge_radius)
-        
+        pygame.draw.rect(surf, self.COLOR_BG_TERTIARY, badge_rect, border_radius=badge_radius)
+        pygame.draw.rect(surf, self.COLOR_GOLD, badge_rect, max(int(3 * self.scale), 2), border_radius=badge_radius)
+
         # Status text with icon (larger) - NO EMOJI
         status_text = ">>> SIMULATION READY <<<"  # Replaced emoji with ASCII
-        status_surface = self.font_display.render(status_text, True, self.COLOR_GOLD)  # Use largest font
+        status_surface = self.render_text(self.font_display, status_text, self.COLOR_GOLD)  # Use largest font
         status_rect = status_surface.get_rect(center=(self.width//2, status_y + int(15 * self.scale)))
-        self.screen.blit(status_surface, status_rect)
-        
+        surf.blit(status_surface, status_rect)
+
+        # === TEST MODE INDICATOR ===
+        if self.test_mode:
+            test_y = self.height - int(80 * self.scale)
+            test_text = self.render_text(self.font_small, "TEST MODE - Press I/M/A to change mode | ESC to exit",
+                                         self.COLOR_ERROR)
+            test_rect = test_text.get_rect(center=(self.width//2, test_y))
+            surf.blit(test_text, test_rect)
+
+        # Strip the fading instruction animates in - the only region
+        # draw_idle_screen repaints per frame
+        instruction_y = self.height - int(120 * self.scale)
+        strip_height = self.font_medium.get_linesize() + int(20 * self.scale)
+        self._idle_inst_rect = pygame.Rect(
+            0, instruction_y - strip_height // 2, self.width, strip_height)
+
+        self._idle_static = surf
+
+    def draw_idle_screen(self):
+        """
+        Display idle/intro screen - Optimized for 4K display
+
+        Static layout comes from the pre-rendered surface; per frame only
+        the fading instruction strip is repainted and pushed with a
+        dirty-rect display.update instead of a full flip.
+        """
+        if self._idle_static is None:
+            self._build_idle_static()
+
+        first_draw = self._last_drawn_mode != 'idle'
+        if first_draw:
+            self.screen.blit(self._idle_static, (0, 0))
+
+        # Update fade animation for instruction text
+        self.idle_fade_alpha += self.idle_fade_direction * self.idle_fade_speed
+        if self.idle_fade_alpha >= 255:
+            self.idle_fade_alpha = 255
+            self.idle_fade_direction = -1
+        elif self.idle_fade_alpha <= 180:
+            self.idle_fade_alpha = 180
+            self.idle_fade_direction = 1
+
         # === BOTTOM SECTION: INSTRUCTIONS ===
-        instruction_y = self.height - int(120 * self.scale)  # Adjusted to avoid overlap
-        
-        # Instruction text with fade animation (Bright Cyan, larger)
+        # Erase the strip from the static layout, then draw the faded text
+        strip = self._idle_inst_rect
+        self.screen.blit(self._idle_static, strip.topleft, strip)
+
         inst_text = ">> Tekan tombol untuk memulai simulasi <<"  # Removed emoji
-        inst_surface = self.font_medium.render(inst_text, True, self.COLOR_ENERGY)  # Changed from font_body
-        
+        inst_surface = self.render_text(self.font_medium, inst_text, self.COLOR_ENERGY)
+
         # Apply fade by adjusting alpha
         inst_surface.set_alpha(int(self.idle_fade_alpha))
-        inst_rect = inst_surface.get_rect(center=(self.width//2, instruction_y))
+        inst_rect = inst_surface.get_rect(center=(self.width//2, strip.centery))
         self.screen.blit(inst_surface, inst_rect)
-        
-        # === TEST MODE INDICATOR ===
-        if self.test_mode:
-            test_y = self.height - int(80 * self.scale)
-            test_text = self.font_small.render("TEST MODE - Press I/M/A to change mode | ESC to exit", 
-                                               True, self.COLOR_ERROR)
-            test_rect = test_text.get_rect(center=(self.width//2, test_y))
-            self.screen.blit(test_text, test_rect)
-        
-        pygame.display.flip()
+
+        if first_draw:
+            pygame.display.flip()
+            self._last_drawn_mode = 'idle'
+        else:
+            pygame.display.update(strip)
     
     def draw_manual_guide(self, state: Dict):
-        """Display interactive step-by-step guide - Optimized for 4K"""
+        """
+        Display interactive step-by-step guide - Optimized for 4K
+
+        Redraw is change-gated: the full layout is repainted only when
+        the step or the warning banner changes; when only parameter
+        values move, just the bars region is repainted and pushed with a
+        dirty-rect display.update; when nothing changed the frame is
+        skipped entirely.
+        """
+        # Advance the step tracker first - the step number is part of
+        # the layout signature below
+        step_text = self.get_current_step_instruction(state)
+
+        current_pressure = state.get("pressure", 0)
+        if current_pressure > 180:
+            warning_level = 2
+        elif current_pressure > 160:
+            warning_level = 1
+        else:
+            warning_level = 0
+
+        bar_values = (int(current_pressure),
+                      int(state.get("safety_rod", 0)),
+                      int(state.get("shim_rod", 0)),
+                      int(state.get("regulating_rod", 0)))
+        layout_sig = (warning_level, self.current_step)
+
+        if self._last_drawn_mode == 'guide' and layout_sig == self._guide_layout_sig:
+            if bar_values != self._guide_bar_values:
+                # Only parameter values changed - repaint the bars region
+                self.screen.fill(self.COLOR_BG, self._guide_bars_rect)
+                self.draw_progress_bar_enhanced(state, self._guide_params_y_start)
+                self._guide_bar_values = bar_values
+                pygame.display.update(self._guide_bars_rect)
+            return
+
+        # Full repaint: mode entry, step advance or banner change
         self.screen.fill(self.COLOR_BG)
-        
+
         # === PRESSURE WARNING NOTIFICATION (TOP) ===
-        current_pressure = state.get("pressure", 0)
         if current_pressure > 160:
             # Show warning banner at top
             banner_height = int(100 * self.scale)
@@ -701,7 +1033,7 @@ class VideoDisplayApp:
             pygame.draw.rect(self.screen, banner_color, (0, 0, self.width, banner_height))
             
             # Warning text (white, bold)
-            warning_surface = self.font_title.render(warning_text, True, self.COLOR_TEXT)
+            warning_surface = self.render_text(self.font_title, warning_text, self.COLOR_TEXT)
             warning_rect = warning_surface.get_rect(center=(self.width//2, banner_height//2))
             self.screen.blit(warning_surface, warning_rect)
             
@@ -731,8 +1063,9 @@ class VideoDisplayApp:
             self.screen.blit(logo_small_brin, (left_margin, logo_y))
         
         # Title text (center) - Larger font
-        header_title = self.font_title.render("SIMULATOR PLTN TIPE PWR BERBASIS MIKROKONTROLER", 
-                                                 True, self.COLOR_TEXT)
+        header_title = self.render_text(self.font_title,
+                                        "SIMULATOR PLTN TIPE PWR BERBASIS MIKROKONTROLER",
+                                        self.COLOR_TEXT)
         header_title_rect = header_title.get_rect(center=(self.width//2, header_y_offset + header_height//2))
         self.screen.blit(header_title, header_title_rect)
         
@@ -746,9 +1079,6 @@ class VideoDisplayApp:
         # === MAIN CONTENT AREA === (more spacious layout)
         content_y_start = header_y_offset + header_height + int(80 * self.scale)  # More space from header
         
-        # Current step instruction
-        step_text = self.get_current_step_instruction(state)
-        
         # Draw step number badge (larger and more prominent)
         badge_size = int(120 * self.scale)  # Increased
         badge_x = self.width // 2 - badge_size // 2
@@ -762,12 +1092,12 @@ class VideoDisplayApp:
                          badge_size//2, max(int(4 * self.scale), 3))
         
         # Step number text
-        step_num_text = self.font_display.render(str(self.current_step + 1), True, self.COLOR_TEXT)
+        step_num_text = self.render_text(self.font_display, str(self.current_step + 1), self.COLOR_TEXT)
         step_num_rect = step_num_text.get_rect(center=(badge_x + badge_size//2, badge_y + badge_size//2))
         self.screen.blit(step_num_text, step_num_rect)
         
         # "STEP" label above badge
-        step_label = self.font_medium.render("STEP", True, self.COLOR_TEXT_TERTIARY)
+        step_label = self.render_text(self.font_medium, "STEP", self.COLOR_TEXT_TERTIARY)
         step_label_rect = step_label.get_rect(center=(self.width//2, badge_y - int(30 * self.scale)))
         self.screen.blit(step_label, step_label_rect)
         
@@ -775,7 +1105,7 @@ class VideoDisplayApp:
         y_offset = content_y_start + badge_size + int(60 * self.scale)
         line_spacing = int(70 * self.scale)  # Increased spacing
         for line in step_text:
-            text = self.font_large.render(line, True, self.COLOR_TEXT)  # Changed from font_body to font_large
+            text = self.render_text(self.font_large, line, self.COLOR_TEXT)  # Changed from font_body to font_large
             text_rect = text.get_rect(center=(self.width//2, y_offset))
             self.screen.blit(text, text_rect)
             y_offset += line_spacing
@@ -784,7 +1114,7 @@ class VideoDisplayApp:
         params_y_start = self.height - int(450 * self.scale)  # More space for parameters
         
         # Section title
-        params_title = self.font_display.render("PARAMETER SISTEM", True, self.COLOR_PRIMARY_BRIGHT)  # Larger font
+        params_title = self.render_text(self.font_display, "PARAMETER SISTEM", self.COLOR_PRIMARY_BRIGHT)  # Larger font
         params_title_rect = params_title.get_rect(center=(self.width//2, params_y_start - int(50 * self.scale)))
         self.screen.blit(params_title, params_title_rect)
         
@@ -798,7 +1128,16 @@ class VideoDisplayApp:
         
         # Draw progress bars (larger)
         self.draw_progress_bar_enhanced(state, params_y_start)
-        
+
+        # Remember the layout painted so the next frame can take the
+        # change-gated fast path
+        self._guide_params_y_start = params_y_start
+        self._guide_bars_rect = pygame.Rect(
+            0, params_y_start, self.width, 4 * int(85 * self.scale))
+        self._guide_layout_sig = layout_sig
+        self._guide_bar_values = bar_values
+        self._last_drawn_mode = 'guide'
+
         pygame.display.flip()
     
     def get_current_step_instruction(self, state: Dict) -> list:
@@ -892,7 +1231,7 @@ class VideoDisplayApp:
             label_text = f"{label}:"
             label_color = self.COLOR_TEXT_TERTIARY
             
-            text = self.font_large.render(label_text, True, label_color)  # Larger font
+            text = self.render_text(self.font_large, label_text, label_color)  # Larger font
             self.screen.blit(text, (x_label, y + int(15 * self.scale)))
             
             # Bar background
@@ -914,7 +1253,7 @@ class VideoDisplayApp:
             pygame.draw.rect(self.screen, self.COLOR_BORDER, bg_rect, border_thickness, border_radius=border_radius)
             
             # Value text (inside bar, larger)
-            value_text = self.font_large.render(f"{value:.0f}{unit}", True, self.COLOR_TEXT)  # Larger font
+            value_text = self.render_text(self.font_large, f"{value:.0f}{unit}", self.COLOR_TEXT)  # Larger font
             value_rect = value_text.get_rect(center=(x_bar + bar_width//2, y + bar_height//2))
             self.screen.blit(value_text, value_rect)
     
@@ -973,17 +1312,17 @@ class VideoDisplayApp:
             self.screen.fill(self.COLOR_BG)
             
             # Title
-            text = self.font_title.render("VIDEO PLAYING", True, self.COLOR_PRIMARY_BRIGHT)
+            text = self.render_text(self.font_title, "VIDEO PLAYING", self.COLOR_PRIMARY_BRIGHT)
             text_rect = text.get_rect(center=(self.width//2, self.height//2 - 30))
             self.screen.blit(text, text_rect)
             
             # Subtitle
-            hint = self.font_body.render("(Simulated - no actual video)", True, self.COLOR_TEXT_TERTIARY)
+            hint = self.render_text(self.font_body, "(Simulated - no actual video)", self.COLOR_TEXT_TERTIARY)
             hint_rect = hint.get_rect(center=(self.width//2, self.height//2 + 20))
             self.screen.blit(hint, hint_rect)
             
             # Instructions
-            inst = self.font_small.render("Press I to return to IDLE", True, self.COLOR_INFO)
+            inst = self.render_text(self.font_small, "Press I to return to IDLE", self.COLOR_INFO)
             inst_rect = inst.get_rect(center=(self.width//2, self.height//2 + 60))
             self.screen.blit(inst, inst_rect)
             
@@ -1155,6 +1494,9 @@ class VideoDisplayApp:
         
         # Cleanup
         self.stop_video()
+        if self.prewarm_player:
+            self.prewarm_player.shutdown()
+            self.prewarm_player = None
         pygame.quit()
         print("👋 Video Display App stopped")
 
@@ -23,6 +23,14 @@ except ImportError:
     logging.warning("RPi.GPIO not available. Buzzer running in simulation mode.")
     GPIO_AVAILABLE = False
 
+# Preferred backend: pigpio waveforms - the daemon plays the beep
+# pattern autonomously with cycle-accurate timing, no Python thread
+try:
+    import pigpio
+    PIGPIO_AVAILABLE = True
+except ImportError:
+    PIGPIO_AVAILABLE = False
+
 logger = logging.getLogger(__name__)
 
 class BuzzerAlarm:
@@ -85,20 +93,85 @@ class BuzzerAlarm:
         self.alarm_lock = threading.Lock()
         self.stop_alarm_flag = False
         self.emergency_beep_active = False  # Flag to protect emergency beep from being cleared
-        
-        # Initialize GPIO
-        if GPIO_AVAILABLE:
+
+        # pigpio waveform backend state
+        self.pi = None           # pigpio connection (None = thread fallback)
+        self.wave_ids = {}       # alarm_type -> compiled waveform id (lazy)
+
+        # Preferred: pigpio waveforms - pattern timing is generated by
+        # the daemon/DMA, immune to CPU load, and needs no alarm thread
+        if PIGPIO_AVAILABLE:
             try:
-                GPIO.setmode(GPIO.BCM)
-                GPIO.setup(self.buzzer_pin, GPIO.OUT)
-                GPIO.output(self.buzzer_pin, GPIO.LOW)
-                logger.info(f"Buzzer alarm initialized on GPIO {self.buzzer_pin}")
+                pi = pigpio.pi()
+                if pi.connected:
+                    pi.set_mode(self.buzzer_pin, pigpio.OUTPUT)
+                    pi.write(self.buzzer_pin, 0)
+                    self.pi = pi
+                    logger.info(f"Buzzer alarm initialized on GPIO {self.buzzer_pin} (pigpio waveforms)")
+                else:
+                    pi.stop()
+                    logger.warning("pigpio daemon not running - falling back to GPIO thread backend")
             except Exception as e:
-                logger.error(f"Failed to initialize buzzer GPIO: {e}")
+                logger.warning(f"pigpio unavailable ({e}) - falling back to GPIO thread backend")
+                self.pi = None
+
+        # Fallback: software PWM toggled by the alarm thread
+        if self.pi is None:
+            if GPIO_AVAILABLE:
+                try:
+                    GPIO.setmode(GPIO.BCM)
+                    GPIO.setup(self.buzzer_pin, GPIO.OUT)
+                    GPIO.output(self.buzzer_pin, GPIO.LOW)
+                    logger.info(f"Buzzer alarm initialized on GPIO {self.buzzer_pin}")
+                except Exception as e:
+                    logger.error(f"Failed to initialize buzzer GPIO: {e}")
+                    self.buzzer_pin = None
+            else:
+                logger.info("Buzzer alarm in simulation mode")
                 self.buzzer_pin = None
-        else:
-            logger.info("Buzzer alarm in simulation mode")
-            self.buzzer_pin = None
+
+    def _build_wave(self, alarm_type):
+        """
+        Compile an alarm pattern into a pigpio waveform (cached)
+
+        Beep segments become explicit square-wave cycles at the alarm
+        frequency, pauses a single low pulse. The daemon then repeats
+        the whole pattern autonomously via wave_send_repeat.
+
+        Returns:
+            Waveform id, or None on failure
+        """
+        if alarm_type in self.wave_ids:
+            return self.wave_ids[alarm_type]
+
+        tone_config = self.ALARM_TONES[alarm_type]
+        freq = tone_config['freq']
+        pattern = tone_config['pattern']
+        pin_bit = 1 << self.buzzer_pin
+
+        pulses = []
+        for i, duration in enumerate(pattern):
+            if i % 2 == 0:
+                # Beep ON: square wave at alarm frequency (50% duty)
+                half_period_us = int(500000 / freq)
+                for _ in range(int(duration * freq)):
+                    pulses.append(pigpio.pulse(pin_bit, 0, half_period_us))
+                    pulses.append(pigpio.pulse(0, pin_bit, half_period_us))
+            else:
+                # Beep OFF (pause): one low pulse
+                pulses.append(pigpio.pulse(0, pin_bit, int(duration * 1000000)))
+
+        try:
+            # wave_add_generic caps at ~5460 pulses per call - chunk it
+            for start in range(0, len(pulses), 5000):
+                self.pi.wave_add_generic(pulses[start:start + 5000])
+            wave_id = self.pi.wave_create()
+            self.wave_ids[alarm_type] = wave_id
+            logger.debug(f"Compiled waveform for '{tone_config['name']}' ({len(pulses)} pulses)")
+            return wave_id
+        except Exception as e:
+            logger.error(f"Failed to build waveform for '{tone_config['name']}': {e}")
+            return None
     
     def _alarm_thread_func(self):
         """Thread function for alarm pattern generation"""
@@ -161,13 +234,26 @@ class BuzzerAlarm:
             if alarm_type != self.current_alarm:
                 old_alarm = self.ALARM_TONES[self.current_alarm]['name']
                 new_alarm = self.ALARM_TONES[alarm_type]['name']
-                
+
                 self.current_alarm = alarm_type
-                
+
                 if alarm_type != self.ALARM_NONE:
                     logger.warning(f"🔊 ALARM ACTIVATED: {new_alarm}")
-                    
-                    # Start alarm thread if not running
+
+                    # pigpio backend: select and start the compiled
+                    # waveform - the daemon repeats it on its own, no
+                    # Python involvement until the alarm changes
+                    if self.pi is not None:
+                        try:
+                            wave_id = self._build_wave(alarm_type)
+                            self.pi.wave_tx_stop()
+                            if wave_id is not None:
+                                self.pi.wave_send_repeat(wave_id)
+                            return
+                        except Exception as e:
+                            logger.error(f"Waveform playback failed ({e}), using thread backend")
+
+                    # Fallback: start alarm thread if not running
                     if not self.alarm_active:
                         self.alarm_active = True
                         self.stop_alarm_flag = False
@@ -179,6 +265,14 @@ class BuzzerAlarm:
                 else:
                     if old_alarm != 'Silent':
                         logger.info(f"🔕 ALARM CLEARED: {old_alarm}")
+
+                    # pigpio backend: just stop transmission
+                    if self.pi is not None:
+                        try:
+                            self.pi.wave_tx_stop()
+                            self.pi.write(self.buzzer_pin, 0)
+                        except Exception as e:
+                            logger.error(f"Waveform stop failed: {e}")
     
     def clear_alarm(self):
         """Clear all alarms"""
@@ -288,8 +382,20 @@ class BuzzerAlarm:
         
         if self.alarm_thread and self.alarm_thread.is_alive():
             self.alarm_thread.join(timeout=2.0)
-        
-        if GPIO_AVAILABLE and self.buzzer_pin:
+
+        # pigpio backend: stop transmission, free waveforms, disconnect
+        if self.pi is not None:
+            try:
+                self.pi.wave_tx_stop()
+                for wave_id in self.wave_ids.values():
+                    self.pi.wave_delete(wave_id)
+                self.wave_ids.clear()
+                self.pi.write(self.buzzer_pin, 0)
+                self.pi.stop()
+            except Exception as e:
+                logger.error(f"pigpio cleanup error: {e}")
+            self.pi = None
+        elif GPIO_AVAILABLE and self.buzzer_pin:
             try:
                 GPIO.output(self.buzzer_pin, GPIO.LOW)
                 GPIO.cleanup(self.buzzer_pin)
@@ -12,6 +12,7 @@ UART_ESP_E_PORT = '/dev/ttyAMA3'     # GPIO 4/5 (UART3)
 UART_BAUDRATE = 115200               # Standard baudrate
 UART_TIMEOUT = 0.5                   # Read timeout in seconds
 UART_UPDATE_INTERVAL = 0.1           # Update interval (100ms)
+UART_STREAM_INTERVAL_MS = 50         # ESP-BC streaming telemetry push rate (0 = poll/ACK mode)
 
 # ============================================
 # I2C Configuration (OLEDs ONLY now)
@@ -27,6 +28,15 @@ TCA9548A_ESP_ADDRESS = 0x71      # For OLED displays only (ESP now on UART)
 I2C_BUS = 1          # I2C Bus 1 (GPIO 2=SDA, GPIO 3=SCL)
 I2C_BUS_DISPLAY = 1  # Same bus for displays
 
+# I2C bus speed profile for the display bus
+# Fast mode (400kHz) - SSD1306 and TCA9548A both support it, and the
+# 9-OLED pipeline needs the bandwidth. The speed itself is set by the
+# firmware at boot; add to /boot/config.txt:
+#   dtparam=i2c_arm_baudrate=400000
+# DualMultiplexerManager verifies the live bus speed against this value
+# at startup and warns when the bus is still at the 100kHz default.
+I2C_BUS_SPEED_HZ = 400000
+
 # OLED Configuration
 OLED_ADDRESS = 0x3C
 OLED_CHANNEL_PRESSURIZER = 0
@@ -121,3 +131,8 @@ LOG_DATA_INTERVAL = 5.0  # Log data setiap 5 detik
 ENABLE_CSV_LOGGING = True
 CSV_LOG_FILE = "pltn_data.csv"
 CSV_LOG_INTERVAL = 1.0   # Log setiap 1 detik
+
+# Flight recorder (binary ring file, see raspi_flight_recorder.py)
+# /dev/shm = tmpfs: no SD card wear, survives a panel restart
+FLIGHT_RECORDER_PATH = "/dev/shm/pltn_flight.bin"
+FLIGHT_RECORDER_SECONDS = 600    # History depth at the 20Hz control rate
@@ -0,0 +1,258 @@
+"""
+Flight Recorder untuk PLTN Simulator
+Binary ring-file history of full panel state at the 20Hz control rate
+
+Post-incident analysis used to mean grepping text logs, and the JSON/shm
+export keeps only the latest snapshot. The flight recorder appends a
+fixed-size packed record (timestamp, every PanelState scalar, UART error
+counters) to a preallocated mmap'd ring file every control tick:
+
+    [magic 4B][version u32][record_size u32][capacity u32][write_count u64]
+    [record 0][record 1]...[record capacity-1]
+
+Hot path cost is one struct.pack and one memcpy into the mapping - no
+syscalls, no allocation beyond the packed bytes. write_count is bumped
+AFTER the record bytes land, so a reader walking the ring never sees a
+half-written record (the kernel flushes pages in the background).
+
+The default ring lives in /dev/shm (tmpfs): zero SD card wear, survives
+a panel restart, and holds 10 minutes of history - when a visitor
+reports "the rods froze for a moment", copy the file and dump it:
+
+    cp /dev/shm/pltn_flight.bin /tmp/incident.bin
+    python3 raspi_flight_recorder.py /tmp/incident.bin -o incident.csv
+
+Usage (writer side):
+    recorder = FlightRecorder()
+    recorder.record(state_snapshot, esp_bc_errors=0, esp_e_errors=0)
+"""
+
+import argparse
+import csv
+import mmap
+import struct
+import sys
+import time
+from pathlib import Path
+from typing import Dict, Iterator
+
+import raspi_config as config
+
+# ============================================
+# Layout Constants
+# ============================================
+
+FLIGHT_MAGIC = b'PLTF'
+FLIGHT_VERSION = 1
+
+# Header: magic, version, record_size, capacity, total records written
+HEADER_FORMAT = '<4sIIIQ'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)  # 24 bytes
+WRITE_COUNT_OFFSET = 16  # offset of the u64 write counter within the header
+
+# Record: every PanelState scalar plus the UART error counters (38 bytes)
+#   timestamp       double (epoch seconds)
+#   mode            u8   (0=manual, 1=auto)
+#   auto_running    u8
+#   emergency       u8
+#   interlock       u8
+#   pressure        float
+#   safety_rod      u8   (0-100%)
+#   shim_rod        u8
+#   regulating_rod  u8
+#   pump_primary    u8   (0=OFF, 1=STARTING, 2=ON, 3=SHUTTING_DOWN)
+#   pump_secondary  u8
+#   pump_tertiary   u8
+#   humid_ct1..ct4  u8   (commanded 0/1)
+#   thermal_kw      float
+#   turbine_speed   float
+#   esp_bc_errors   u16  (UARTDevice error_count, saturated)
+#   esp_e_errors    u16
+RECORD_FORMAT = '<dBBBBfBBBBBBBBBBffHH'
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+RECORD_FIELDS = [
+    "timestamp", "mode", "auto_running", "emergency", "interlock",
+    "pressure", "safety_rod", "shim_rod", "regulating_rod",
+    "pump_primary", "pump_secondary", "pump_tertiary",
+    "humid_ct1", "humid_ct2", "humid_ct3", "humid_ct4",
+    "thermal_kw", "turbine_speed", "esp_bc_errors", "esp_e_errors"
+]
+
+# Default ring depth: 10 minutes at the 20Hz control rate (~456 KB)
+DEFAULT_CAPACITY = config.FLIGHT_RECORDER_SECONDS * 20
+
+
+# ============================================
+# Writer (panel controller side)
+# ============================================
+
+class FlightRecorder:
+    """
+    Ring-file writer - owns the mmap, called from control_logic_thread
+
+    Raises OSError/ValueError from __init__ if the backing file can't be
+    created - caller should continue without a recorder (non-critical).
+    """
+
+    def __init__(self, path: str = None, capacity: int = DEFAULT_CAPACITY):
+        self.path = Path(path or config.FLIGHT_RECORDER_PATH)
+        self.capacity = int(capacity)
+        self.write_count = 0
+
+        # Preallocate the whole ring up front so record() never extends
+        # the file (extending would mean syscalls on the hot path)
+        total_size = HEADER_SIZE + self.capacity * RECORD_SIZE
+        with open(self.path, 'wb') as f:
+            f.write(b'\x00' * total_size)
+
+        self._file = open(self.path, 'r+b')
+        self._mmap = mmap.mmap(self._file.fileno(), total_size)
+
+        self._mmap[:HEADER_SIZE] = struct.pack(
+            HEADER_FORMAT, FLIGHT_MAGIC, FLIGHT_VERSION,
+            RECORD_SIZE, self.capacity, 0)
+
+    def record(self, state, esp_bc_errors: int = 0, esp_e_errors: int = 0,
+               timestamp: float = None):
+        """
+        Append one record to the ring (struct.pack + memcpy, no syscalls)
+
+        Args:
+            state: PanelState (or any object with the same scalar fields)
+            esp_bc_errors: UARTDevice error_count for the ESP-BC link
+            esp_e_errors: UARTDevice error_count for the ESP-E link
+            timestamp: epoch seconds (defaults to time.time())
+        """
+        record = struct.pack(
+            RECORD_FORMAT,
+            timestamp if timestamp is not None else time.time(),
+            1 if state.simulation_mode == 'auto' else 0,
+            1 if state.auto_sim_running else 0,
+            1 if state.emergency_active else 0,
+            1 if state.interlock_satisfied else 0,
+            float(state.pressure),
+            int(state.safety_rod) & 0xFF,
+            int(state.shim_rod) & 0xFF,
+            int(state.regulating_rod) & 0xFF,
+            int(state.pump_primary_status) & 0xFF,
+            int(state.pump_secondary_status) & 0xFF,
+            int(state.pump_tertiary_status) & 0xFF,
+            int(state.humid_ct1_cmd) & 0xFF,
+            int(state.humid_ct2_cmd) & 0xFF,
+            int(state.humid_ct3_cmd) & 0xFF,
+            int(state.humid_ct4_cmd) & 0xFF,
+            float(state.thermal_kw),
+            float(state.turbine_speed),
+            min(int(esp_bc_errors), 0xFFFF),
+            min(int(esp_e_errors), 0xFFFF)
+        )
+
+        slot = self.write_count % self.capacity
+        offset = HEADER_SIZE + slot * RECORD_SIZE
+        self._mmap[offset:offset + RECORD_SIZE] = record
+
+        # Publish AFTER the record bytes are in place - a reader trusts
+        # only records below write_count
+        self.write_count += 1
+        self._mmap[WRITE_COUNT_OFFSET:WRITE_COUNT_OFFSET + 8] = \
+            struct.pack('<Q', self.write_count)
+
+    def close(self):
+        """Release the mapping (ring file stays on disk for analysis)"""
+        try:
+            self._mmap.close()
+            self._file.close()
+        except Exception:
+            pass
+
+
+# ============================================
+# Offline Reader / CSV Dump Tool
+# ============================================
+
+def iter_records(path: str) -> Iterator[Dict]:
+    """
+    Yield records from a ring file oldest-first
+
+    Args:
+        path: ring file (ideally a copy - a live writer keeps wrapping)
+
+    Raises:
+        ValueError: bad magic/version/size (not a flight-recorder file)
+    """
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    if len(data) < HEADER_SIZE:
+        raise ValueError("File too small for flight-recorder header")
+
+    magic, version, record_size, capacity, write_count = \
+        struct.unpack_from(HEADER_FORMAT, data, 0)
+    if magic != FLIGHT_MAGIC:
+        raise ValueError(f"Bad magic {magic!r} (expected {FLIGHT_MAGIC!r})")
+    if version != FLIGHT_VERSION:
+        raise ValueError(f"Unsupported version {version}")
+    if record_size != RECORD_SIZE:
+        raise ValueError(f"Record size mismatch: file={record_size}, "
+                         f"tool={RECORD_SIZE} (tool/panel out of sync)")
+    if len(data) < HEADER_SIZE + capacity * record_size:
+        raise ValueError("Truncated ring file")
+
+    # Oldest record: slot 0 until the ring wraps, then the next-to-be-
+    # overwritten slot
+    count = min(write_count, capacity)
+    start = 0 if write_count <= capacity else write_count % capacity
+
+    for i in range(count):
+        slot = (start + i) % capacity
+        offset = HEADER_SIZE + slot * record_size
+        values = struct.unpack_from(RECORD_FORMAT, data, offset)
+        yield dict(zip(RECORD_FIELDS, values))
+
+
+def dump_csv(ring_path: str, out_file):
+    """Write all records from a ring file to out_file as CSV"""
+    writer = csv.writer(out_file)
+    writer.writerow(RECORD_FIELDS)
+    count = 0
+    for rec in iter_records(ring_path):
+        writer.writerow([
+            f"{rec['timestamp']:.3f}",
+            'auto' if rec['mode'] else 'manual',
+            rec['auto_running'], rec['emergency'], rec['interlock'],
+            f"{rec['pressure']:.2f}",
+            rec['safety_rod'], rec['shim_rod'], rec['regulating_rod'],
+            rec['pump_primary'], rec['pump_secondary'], rec['pump_tertiary'],
+            rec['humid_ct1'], rec['humid_ct2'], rec['humid_ct3'], rec['humid_ct4'],
+            f"{rec['thermal_kw']:.1f}",
+            f"{rec['turbine_speed']:.1f}",
+            rec['esp_bc_errors'], rec['esp_e_errors']
+        ])
+        count += 1
+    return count
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Dump a PLTN flight-recorder ring file to CSV')
+    parser.add_argument('ring_file',
+                        help='Ring file (copy it first if the panel is live)')
+    parser.add_argument('-o', '--output', default='-',
+                        help='Output CSV path (default: stdout)')
+    args = parser.parse_args()
+
+    try:
+        if args.output == '-':
+            count = dump_csv(args.ring_file, sys.stdout)
+        else:
+            with open(args.output, 'w', newline='') as f:
+                count = dump_csv(args.ring_file, f)
+            print(f"✅ {count} records written to {args.output}")
+    except (OSError, ValueError) as e:
+        print(f"❌ {e}", file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
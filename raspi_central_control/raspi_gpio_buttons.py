@@ -77,18 +77,25 @@ BUTTON_NAMES = {
 # ============================================
 
 class ButtonHandler:
-    """Handles all physical push buttons with debouncing"""
-    
+    """Handles all physical push buttons via kernel edge detection"""
+
     def __init__(self, debounce_time=0.03):
         """
-        Initialize GPIO buttons with HYBRID detection
-        
+        Initialize GPIO buttons with kernel edge detection (interrupts)
+
+        No polling anywhere: edge buttons fire their callback once per
+        press from the GPIO interrupt thread (sub-ms latency), level
+        buttons track pressed/released state from BOTH edges into an
+        in-memory held set, and hold repeats are generated from that set
+        by check_hold_buttons(). Debounce is done on edge timestamps on
+        top of the kernel-side bouncetime filter.
+
         Args:
             debounce_time: Debounce delay in seconds (default: 30ms - optimized for responsiveness)
         """
         self.debounce_time = debounce_time
         self.last_press_time = {}
-        self.last_state = {}
+        self.held_pins = set()  # Level buttons currently pressed
         self.callbacks = {}
         
         # ============================================
@@ -130,10 +137,22 @@ class ButtonHandler:
         # (Buttons connect pin to GND when pressed)
         for pin in ButtonPin:
             GPIO.setup(pin, GPIO.IN, pull_up_down=GPIO.PUD_UP)
-            self.last_press_time[pin] = 0
-            self.last_state[pin] = GPIO.HIGH
-            
-        logger.info("GPIO Button Handler initialized (HYBRID mode)")
+            self.last_press_time[pin] = 0.0
+
+        # Register kernel edge detection - callbacks run on the GPIO
+        # interrupt thread and push events straight into the consumer's
+        # queue, so press-to-detection latency is interrupt latency, not
+        # a poll period. bouncetime gives a first kernel-side filter.
+        for pin in self.EDGE_BUTTONS:
+            GPIO.add_event_detect(pin, GPIO.FALLING,
+                                  callback=self._on_edge_event,
+                                  bouncetime=int(debounce_time * 1000))
+        for pin in self.LEVEL_BUTTONS:
+            GPIO.add_event_detect(pin, GPIO.BOTH,
+                                  callback=self._on_level_event,
+                                  bouncetime=5)
+
+        logger.info("GPIO Button Handler initialized (kernel edge detection)")
         logger.info(f"  - Edge detection: {len(self.EDGE_BUTTONS)} buttons (toggle)")
         logger.info(f"  - Level detection: {len(self.LEVEL_BUTTONS)} buttons (continuous)")
         logger.info(f"  - Debounce time: {debounce_time*1000:.0f}ms")
@@ -149,91 +168,87 @@ class ButtonHandler:
         self.callbacks[button_pin] = callback
         logger.info(f"Callback registered: {BUTTON_NAMES[button_pin]}")
     
-    def check_all_buttons(self):
+    def _dispatch(self, pin):
+        """Invoke the registered callback for a pin (any thread)"""
+        if pin in self.callbacks:
+            try:
+                self.callbacks[pin]()
+            except Exception as e:
+                logger.error(f"Error in callback for {BUTTON_NAMES[pin]}: {e}")
+        else:
+            logger.warning(f"⚠ No callback registered for {BUTTON_NAMES[pin]}")
+
+    def _on_edge_event(self, pin):
         """
-        Check all buttons with HYBRID detection (edge + level)
-        Should be called frequently (e.g., every 5ms) in main loop
+        FALLING-edge interrupt callback for toggle buttons
+
+        Runs on the RPi.GPIO event thread. The consumer callbacks only
+        enqueue a ButtonEvent (Queue.put is thread-safe), so this stays
+        fast and never blocks the interrupt thread.
         """
+        pin = ButtonPin(pin)
         current_time = time.time()
-        
-        for pin in ButtonPin:
-            current_state = GPIO.input(pin)
-            
-            # ============================================
-            # EDGE DETECTION (for toggle buttons)
-            # ============================================
-            if pin in self.EDGE_BUTTONS:
-                # Detect HIGH to LOW transition (button press)
-                if current_state == GPIO.LOW and self.last_state[pin] == GPIO.HIGH:
-                    # 2-sample confirmation to filter bounce noise
-                    time.sleep(0.002)  # Wait 2ms
-                    if GPIO.input(pin) == GPIO.LOW:  # Still pressed?
-                        # Check debounce
-                        time_since_last = current_time - self.last_press_time[pin]
-                        
-                        if time_since_last > self.debounce_time:
-                            self.last_press_time[pin] = current_time
-                            
-                            logger.info(f"✓ Button pressed (EDGE): {BUTTON_NAMES[pin]}")
-                            
-                            # Trigger callback if registered
-                            if pin in self.callbacks:
-                                try:
-                                    self.callbacks[pin]()
-                                except Exception as e:
-                                    logger.error(f"Error in callback for {BUTTON_NAMES[pin]}: {e}")
-                            else:
-                                logger.warning(f"⚠ No callback registered for {BUTTON_NAMES[pin]}")
-            
-            # ============================================
-            # LEVEL DETECTION (for continuous buttons)
-            # ============================================
-            elif pin in self.LEVEL_BUTTONS:
-                # Trigger while button is held (LOW)
-                if current_state == GPIO.LOW:
-                    time_since_last = current_time - self.last_press_time[pin]
-                    
-                    # Rate limiting: trigger every 50ms while held
-                    if time_since_last > 0.05:  # 50ms repeat interval
-                        self.last_press_time[pin] = current_time
-                        
-                        logger.debug(f"✓ Button held (LEVEL): {BUTTON_NAMES[pin]}")
-                        
-                        # Trigger callback if registered
-                        if pin in self.callbacks:
-                            try:
-                                self.callbacks[pin]()
-                            except Exception as e:
-                                logger.error(f"Error in callback for {BUTTON_NAMES[pin]}: {e}")
-            
-            # Update last state AFTER checking
-            self.last_state[pin] = current_state
-    
+
+        # Edge-timestamp debounce on top of the kernel bouncetime
+        if current_time - self.last_press_time[pin] < self.debounce_time:
+            return
+
+        # Confirm the line is still low - filters glitch edges
+        if GPIO.input(pin) != GPIO.LOW:
+            return
+
+        self.last_press_time[pin] = current_time
+        logger.info(f"✓ Button pressed (EDGE): {BUTTON_NAMES[pin]}")
+        self._dispatch(pin)
+
+    def _on_level_event(self, pin):
+        """
+        BOTH-edge interrupt callback for hold buttons
+
+        Maintains the held set from press/release edges. The first
+        trigger fires immediately here; repeats while held come from
+        check_hold_buttons().
+        """
+        pin = ButtonPin(pin)
+
+        if GPIO.input(pin) == GPIO.LOW:
+            if pin not in self.held_pins:
+                self.held_pins.add(pin)
+                self.last_press_time[pin] = time.time()
+                logger.debug(f"✓ Button pressed (LEVEL): {BUTTON_NAMES[pin]}")
+                self._dispatch(pin)
+        else:
+            self.held_pins.discard(pin)
+
     def check_hold_buttons(self, hold_interval=0.05):
         """
-        Check if buttons are being HELD (LEVEL detection)
-        Returns set of ButtonPin that are currently pressed (LOW)
-        
-        This allows continuous action while holding button (for rods and pressure)
-        
+        Repeat generator for held LEVEL buttons
+        Returns set of ButtonPin due for a repeat action
+
+        Walks the in-memory held set maintained by the edge callbacks -
+        no GPIO scan across all pins. Each held pin is re-validated
+        against the actual line level so a missed RISING edge can't
+        wedge a button in the held state.
+
         Args:
             hold_interval: Minimum interval between repeated actions (default 50ms)
-            
+
         Returns:
-            set: Set of ButtonPin currently pressed
+            set: Set of ButtonPin due for a repeat
         """
         current_time = time.time()
         pressed_buttons = set()
-        
-        for pin in ButtonPin:
-            current_state = GPIO.input(pin)
-            
-            # Check if button is pressed (LOW) and interval passed
-            if current_state == GPIO.LOW:
-                if current_time - self.last_press_time[pin] > hold_interval:
-                    pressed_buttons.add(pin)
-                    self.last_press_time[pin] = current_time
-        
+
+        for pin in list(self.held_pins):
+            if GPIO.input(pin) != GPIO.LOW:
+                # Missed release edge - self-heal
+                self.held_pins.discard(pin)
+                continue
+
+            if current_time - self.last_press_time[pin] > hold_interval:
+                pressed_buttons.add(pin)
+                self.last_press_time[pin] = current_time
+
         return pressed_buttons
     
     def is_button_pressed(self, button_pin):
@@ -253,6 +268,7 @@ class ButtonHandler:
         logger.info("Cleaning up GPIO pins for Button Handler...")
         for pin in ButtonPin:
             try:
+                GPIO.remove_event_detect(pin)
                 GPIO.cleanup(pin)
             except Exception as e:
                 logger.error(f"Error cleaning up GPIO pin {pin}: {e}")
@@ -272,12 +288,15 @@ if __name__ == "__main__":
     print()
     
     handler = ButtonHandler()
-    
+
     try:
+        # Edge buttons fire via interrupt callbacks; only hold repeats
+        # need a periodic check
         while True:
-            handler.check_all_buttons()
-            time.sleep(0.01)  # 10ms polling
-            
+            for pin in handler.check_hold_buttons():
+                print(f"  (held) {BUTTON_NAMES[pin]}")
+            time.sleep(0.05)
+
     except KeyboardInterrupt:
         print("\n\nTest interrupted by user")
         handler.cleanup()
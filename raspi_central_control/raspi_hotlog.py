@@ -0,0 +1,257 @@
+"""
+Lazy Structured Logging for Hot Communication Paths
+
+The 50ms comm loop was spending double-digit CPU percentages on logging:
+every cycle built an f-string with a full dict repr, and every binary TX
+frame was hex-dumped at INFO before the bytes even left the port.
+
+This module decouples capture from formatting:
+- Log sites call hotlog.record() which appends raw values (frame bytes,
+  state ints) into a preallocated ring buffer - zero formatting, zero
+  allocation beyond one tuple
+- A low-priority drain thread wakes every 250ms, formats the entries
+  (bytes are rendered as hex dumps lazily, at drain time) and emits them
+  through the normal logging module
+- Per-site rate limiting: repeated entries from the same site within the
+  configured interval are collapsed into one line with a "+N similar"
+  suffix, so a 20Hz loop produces 1 log line per second instead of 20
+- Runtime verbosity switch: set_level() / set_enabled() change what the
+  hot path even bothers to capture, without touching logger config
+
+If the ring overflows before the drain runs, the oldest entries are
+overwritten and counted - diagnostics degrade gracefully instead of
+slowing the comm thread down.
+
+Usage:
+    from raspi_hotlog import hotlog
+
+    hotlog.record(logging.INFO, 'uart.tx', "TX %s: [%s]", port, frame_bytes)
+"""
+
+import logging
+import threading
+import time
+
+logger = logging.getLogger(__name__)
+
+# Ring buffer capacity (entries). 512 covers >6s of a 20Hz x 4-site load.
+DEFAULT_CAPACITY = 512
+
+# How often the drain thread wakes to format and emit
+DRAIN_INTERVAL = 0.25
+
+# Default minimum interval between emitted lines per site
+DEFAULT_RATE_LIMIT_S = 1.0
+
+
+class HotLog:
+    """
+    Preallocated ring buffer logger with a background drain thread
+
+    record() is the only method called from hot paths - everything else
+    (formatting, rate limiting, handler I/O) happens on the drain thread.
+    """
+
+    def __init__(self, capacity=DEFAULT_CAPACITY, drain_interval=DRAIN_INTERVAL):
+        self.capacity = capacity
+        self.buffer = [None] * capacity  # Preallocated slots
+        self.head = 0                    # Next write index
+        self.count = 0                   # Valid entries in ring
+        self.overwritten = 0             # Entries lost to overflow
+        self.lock = threading.Lock()
+
+        # Runtime verbosity switch (checked on the hot path, one compare)
+        self.enabled = True
+        self.level = logging.INFO
+
+        # Per-site rate limiting state (drain thread only)
+        self.rate_limits = {}   # site -> min seconds between emitted lines
+        self._last_emit = {}    # site -> timestamp of last emitted line
+        self._suppressed = {}   # site -> count collapsed since last emit
+
+        self.drain_interval = drain_interval
+        self._drain_thread = None
+        self._running = False
+
+    # ============================================
+    # Hot path
+    # ============================================
+
+    def record(self, level, site, fmt, *args):
+        """
+        Capture a log entry with zero formatting (hot path)
+
+        Values are stored raw; bytes are hex-dumped and the format string
+        applied only when the drain thread emits the entry.
+
+        Args:
+            level: logging level (logging.INFO, logging.DEBUG, ...)
+            site: Short site key, also the rate-limit bucket (e.g. 'uart.tx:/dev/ttyAMA0')
+            fmt: %-style format string applied at drain time
+            *args: Raw values (ints, strings, bytes) captured as-is
+        """
+        if not self.enabled or level < self.level:
+            return
+
+        entry = (time.time(), level, site, fmt, args)
+        with self.lock:
+            if self.buffer[self.head] is not None:
+                self.overwritten += 1
+            else:
+                self.count += 1
+            self.buffer[self.head] = entry
+            self.head = (self.head + 1) % self.capacity
+
+        if self._drain_thread is None:
+            self._start_drain()
+
+    # ============================================
+    # Configuration (any thread)
+    # ============================================
+
+    def set_enabled(self, enabled):
+        """Master switch - disabled record() is a single attribute check"""
+        self.enabled = enabled
+
+    def set_level(self, level):
+        """Runtime verbosity: entries below this level are not captured"""
+        self.level = level
+
+    def set_rate_limit(self, site, min_interval_s):
+        """
+        Set minimum interval between emitted lines for a site
+        Entries arriving faster are collapsed into a "+N similar" suffix
+
+        Args:
+            site: Site key as passed to record()
+            min_interval_s: Minimum seconds between emitted lines
+        """
+        self.rate_limits[site] = min_interval_s
+
+    # ============================================
+    # Drain thread
+    # ============================================
+
+    def _start_drain(self):
+        """Start the background drain thread (idempotent)"""
+        with self.lock:
+            if self._drain_thread is not None:
+                return
+            self._running = True
+            self._drain_thread = threading.Thread(
+                target=self._drain_loop,
+                daemon=True,
+                name="HotLogDrain"
+            )
+            self._drain_thread.start()
+
+    def _drain_loop(self):
+        """Drain thread: sleep, format, emit - never touches hot paths"""
+        while self._running:
+            time.sleep(self.drain_interval)
+            try:
+                self.flush()
+            except Exception as e:
+                logger.error(f"HotLog drain error: {e}")
+
+    def flush(self):
+        """
+        Format and emit all buffered entries (drain thread or shutdown)
+        """
+        with self.lock:
+            if self.count == 0 and self.overwritten == 0:
+                return
+            # Extract oldest-first, then clear the ring
+            start = (self.head - self.count) % self.capacity
+            entries = [self.buffer[(start + i) % self.capacity]
+                       for i in range(self.count)]
+            lost = self.overwritten
+            self.buffer = [None] * self.capacity
+            self.head = 0
+            self.count = 0
+            self.overwritten = 0
+
+        if lost:
+            logger.warning(f"⚠️  HotLog ring overflow: {lost} entries lost before drain")
+
+        for timestamp, level, site, fmt, args in entries:
+            # Per-site rate limit: collapse bursts into one line
+            min_interval = self.rate_limits.get(site, DEFAULT_RATE_LIMIT_S)
+            last = self._last_emit.get(site, 0.0)
+            if timestamp - last < min_interval:
+                self._suppressed[site] = self._suppressed.get(site, 0) + 1
+                continue
+
+            try:
+                message = fmt % tuple(self._render(a) for a in args)
+            except Exception as e:
+                message = f"{fmt!r} % {args!r} (format error: {e})"
+
+            suppressed = self._suppressed.pop(site, 0)
+            if suppressed:
+                message += f" (+{suppressed} similar suppressed)"
+
+            self._last_emit[site] = timestamp
+            logger.log(level, message)
+
+    @staticmethod
+    def _render(value):
+        """Lazy value rendering: bytes become hex dumps at drain time"""
+        if isinstance(value, (bytes, bytearray)):
+            return ' '.join(f'{b:02X}' for b in value)
+        return value
+
+    def stop(self):
+        """Stop the drain thread and flush remaining entries"""
+        self._running = False
+        if self._drain_thread and self._drain_thread.is_alive():
+            self._drain_thread.join(timeout=1.0)
+        self._drain_thread = None
+        self.flush()
+
+
+# Module-level singleton - all hot paths share one ring/drain thread
+hotlog = HotLog()
+
+
+# ============================================
+# Test Function
+# ============================================
+
+if __name__ == "__main__":
+    logging.basicConfig(level=logging.DEBUG, format='%(levelname)s: %(message)s')
+
+    print("=" * 60)
+    print("  HotLog Self-Test")
+    print("=" * 60)
+
+    # Test 1: lazy hex rendering
+    print("\nTest 1: bytes rendered as hex at drain time")
+    hotlog.record(logging.INFO, 'test.tx', "TX %s: [%s] (%d bytes)",
+                  '/dev/ttyAMA0', bytes([0x02, 0x55, 0x0A, 0x03]), 4)
+    hotlog.flush()
+
+    # Test 2: rate limiting collapses a burst
+    print("\nTest 2: 20-entry burst collapses to one line")
+    for i in range(20):
+        hotlog.record(logging.INFO, 'test.burst', "cycle %d", i)
+    hotlog.flush()
+
+    # Test 3: verbosity switch drops entries on the hot path
+    print("\nTest 3: entries below level are not captured")
+    hotlog.set_level(logging.WARNING)
+    hotlog.record(logging.INFO, 'test.dropped', "should not appear")
+    hotlog.flush()
+    hotlog.set_level(logging.INFO)
+    assert hotlog.count == 0
+
+    # Test 4: ring overflow is counted, not blocking
+    print("\nTest 4: overflow overwrites oldest and reports count")
+    small = HotLog(capacity=8)
+    small.set_rate_limit('test.ovf', 0.0)
+    for i in range(12):
+        small.record(logging.INFO, 'test.ovf', "entry %d", i)
+    small.flush()
+
+    hotlog.stop()
+    print("\n✅ All tests passed")
@@ -10,7 +10,7 @@ import sys
 import threading
 import json
 from pathlib import Path
-from dataclasses import dataclass, asdict
+from dataclasses import dataclass, asdict, replace
 from typing import Optional
 from queue import Queue, Empty
 from enum import Enum
@@ -23,6 +23,9 @@ from raspi_gpio_buttons import ButtonHandler as ButtonManager, ButtonPin
 from raspi_humidifier_control import HumidifierController
 from raspi_buzzer_alarm import BuzzerAlarm
 from raspi_system_health import SystemHealthMonitor
+from raspi_state_shm import StateShmWriter, STATE_SHM_PATH
+from raspi_flight_recorder import FlightRecorder
+from raspi_hotlog import hotlog
 
 # Try to import GPIO library
 try:
@@ -168,11 +171,50 @@ class PLTNPanelController:
         # Threading locks
         self.uart_lock = threading.Lock()  # Changed from i2c_lock
         self.state_lock = threading.Lock()
-        
+
+        # Mailbox for the ESP-E I/O worker: the comm thread publishes the
+        # latest display setpoints here, the worker drains it at its own
+        # pace on its own port. ESP-E (display peripheral) can never delay
+        # the ESP-BC control link this way - each UARTDevice has its own
+        # lock and the two ports run concurrently.
+        self.esp_e_mailbox = None
+        self.esp_e_mailbox_lock = threading.Lock()
+
+        # Seqlock-style published state snapshot. Writers keep mutating
+        # self.state under state_lock as before, then publish an immutable
+        # copy here. Readers (OLED, state export, status loop, UART TX
+        # path) grab the latest copy WITHOUT touching state_lock at all -
+        # a single attribute read is atomic in CPython, so a reader can
+        # never stall behind a writer holding the lock across slow work.
+        self.state_snapshot = replace(self.state)
+        self.state_generation = 0
+
         # State export for video display integration
+        # Primary channel: binary seqlock struct in /dev/shm (tmpfs -
+        # one memcpy per update, zero SD card writes). JSON temp-file
+        # export is kept only as a fallback when shm init fails.
         self.state_export_file = Path("/tmp/pltn_state.json")
-        logger.info(f"State export file: {self.state_export_file}")
-        
+        self.state_shm_writer = None
+        try:
+            self.state_shm_writer = StateShmWriter()
+            logger.info(f"State export: shared memory at {STATE_SHM_PATH}")
+        except (OSError, ValueError) as e:
+            logger.warning(f"⚠️  Shared-memory export unavailable ({e}), "
+                           f"falling back to JSON: {self.state_export_file}")
+
+        # Flight recorder: full panel state packed into an mmap'd ring
+        # file every control tick - post-incident history where the
+        # shm/JSON export only keeps the latest snapshot. Dump with:
+        #   python3 raspi_flight_recorder.py <ring file> -o incident.csv
+        self.flight_recorder = None
+        try:
+            self.flight_recorder = FlightRecorder()
+            logger.info(f"Flight recorder: {config.FLIGHT_RECORDER_PATH} "
+                        f"({config.FLIGHT_RECORDER_SECONDS}s ring)")
+        except (OSError, ValueError) as e:
+            logger.warning(f"⚠️  Flight recorder unavailable ({e}) - "
+                           f"continuing without state history")
+
         # System health monitor
         logger.info("Phase 3: System health check...")
         self.health_monitor = SystemHealthMonitor()
@@ -200,7 +242,8 @@ class PLTNPanelController:
                 display_bus=config.I2C_BUS_DISPLAY,
                 esp_bus=config.I2C_BUS_DISPLAY,  # Both on same bus now (OLEDs only)
                 display_addr=config.TCA9548A_DISPLAY_ADDRESS,
-                esp_addr=config.TCA9548A_ESP_ADDRESS
+                esp_addr=config.TCA9548A_ESP_ADDRESS,
+                expected_speed_hz=config.I2C_BUS_SPEED_HZ
             )
             logger.info("✓ Multiplexers initialized (OLEDs only)")
         except Exception as e:
@@ -848,7 +891,11 @@ class PLTNPanelController:
                     
                     # Process event with lock
                     self.process_button_event(event)
-                    
+
+                    # Publish updated snapshot so OLED/export see the
+                    # change immediately (not after next control cycle)
+                    self.publish_state_snapshot()
+
                     # Trigger immediate ESP communication for fast response
                     self.esp_send_immediate.set()
                     
@@ -870,10 +917,40 @@ class PLTNPanelController:
             import traceback
             logger.critical(traceback.format_exc())
     
+    # ============================================
+    # State Snapshot (seqlock-style publication)
+    # ============================================
+
+    def publish_state_snapshot(self):
+        """
+        Publish an immutable copy of the current state for lock-free readers
+
+        Called by writer threads after a batch of mutations (button event
+        processor, control logic cycle, ESP telemetry write-back). Cheap:
+        one dataclass copy under state_lock, then one atomic assignment.
+
+        Auto-sim and SCRAM mutations don't publish individually - the
+        control logic thread publishes every 50ms, so snapshot staleness
+        is bounded well below the 100ms reader cadence.
+        """
+        with self.state_lock:
+            snapshot = replace(self.state)
+        self.state_generation += 1
+        self.state_snapshot = snapshot
+
+    def get_state_snapshot(self) -> PanelState:
+        """
+        Get the latest published state copy - never blocks, never contends
+
+        Returns:
+            Consistent PanelState copy (do NOT mutate - it's shared)
+        """
+        return self.state_snapshot
+
     # ============================================
     # Interlock Logic
     # ============================================
-    
+
     def check_interlock(self) -> bool:
         """
         Check if interlock conditions are satisfied for rod movement
@@ -1090,6 +1167,25 @@ class PLTNPanelController:
                     logger.debug("Control: All updates done, releasing lock...")
                 
                 logger.debug("Control: Lock released")
+
+                # Publish snapshot for lock-free readers (every 50ms cycle)
+                self.publish_state_snapshot()
+
+                # Flight recorder: one packed record per tick (struct.pack
+                # + memcpy into the mmap ring - no syscalls on this path)
+                if self.flight_recorder:
+                    try:
+                        uart = self.uart_master
+                        self.flight_recorder.record(
+                            self.get_state_snapshot(),
+                            esp_bc_errors=uart.esp_bc.error_count
+                                if uart and hasattr(uart, 'esp_bc') else 0,
+                            esp_e_errors=uart.esp_e.error_count
+                                if uart and hasattr(uart, 'esp_e') else 0
+                        )
+                    except Exception as e:
+                        logger.debug(f"Flight recorder error: {e}")
+
                 time.sleep(0.05)  # 50ms
                 
                 # Log heartbeat every 10 seconds (200 loops x 50ms)
@@ -1185,114 +1281,207 @@ class PLTNPanelController:
             return
         
         logger.info("✓ UART master verified, starting communication loop...")
-        
-        # Throttle ESP-E updates to prevent buffer overflow
-        last_esp_e_update = 0
-        ESP_E_UPDATE_INTERVAL = 0.2  # 200ms (5x per second) - was 50ms (20x per second)
-        
+
+        # Try to enable streaming telemetry on ESP-BC (CMD_STREAM)
+        # In streaming mode the ESP pushes telemetry unsolicited and commands
+        # are only sent when setpoints change - no poll/ACK round-trip
+        streaming = False
+        if config.UART_STREAM_INTERVAL_MS > 0 and self.uart_master.esp_bc_connected:
+            try:
+                streaming = self.uart_master.enable_esp_bc_streaming(config.UART_STREAM_INTERVAL_MS)
+            except Exception as e:
+                logger.warning(f"⚠️  Failed to enable ESP-BC streaming: {e}")
+
+        if streaming:
+            logger.info(f"✓ ESP-BC streaming mode active ({config.UART_STREAM_INTERVAL_MS}ms telemetry)")
+        else:
+            logger.info("ℹ️  ESP-BC in poll/ACK mode (streaming unavailable)")
+
+        # Last setpoints sent in streaming mode (send only on change)
+        last_setpoints = None
+
         while self.state.running:
             try:
                 # Wait for either timeout (50ms) OR immediate trigger from button event
                 triggered = self.esp_send_immediate.wait(timeout=0.05)  # 50ms optimized cycle
-                
+
                 if triggered:
                     logger.debug("⚡ Immediate ESP send triggered by button event")
                     self.esp_send_immediate.clear()  # Reset flag
-                
-                with self.uart_lock:
-                    with self.state_lock:
-                        # Send to ESP-BC (Control Rods + Pumps + Turbine + Humidifier)
-                        logger.info(f"TX /dev/ttyAMA0: { {'cmd':'update', 'rods':[self.state.safety_rod,self.state.shim_rod,self.state.regulating_rod], 'pumps':[self.state.pump_primary_status,self.state.pump_secondary_status,self.state.pump_tertiary_status], 'humid_ct':[self.state.humid_ct1_cmd,self.state.humid_ct2_cmd,self.state.humid_ct3_cmd,self.state.humid_ct4_cmd]} }")
-                        
-                        if not self.uart_master.esp_bc_connected:
-                            logger.warning("⚠️  ESP-BC not connected, skipping UART send")
-                            success = False
-                        else:
-                            success = self.uart_master.update_esp_bc(
-                            self.state.safety_rod,
-                            self.state.shim_rod,
-                            self.state.regulating_rod,
-                            self.state.pump_primary_status,
-                            self.state.pump_secondary_status,
-                            self.state.pump_tertiary_status,
-                            self.state.humid_ct1_cmd,
-                            self.state.humid_ct2_cmd,
-                            self.state.humid_ct3_cmd,
-                            self.state.humid_ct4_cmd
-                        )
-                        
-                        if success:
-                            logger.debug("✓ ESP-BC update success")
-                            # Get data back from ESP-BC
-                            esp_bc_data = self.uart_master.get_esp_bc_data()
-                            self.state.thermal_kw = esp_bc_data.kw_thermal
-                            self.state.turbine_speed = esp_bc_data.turbine_speed
-                            # Gap before sending to ESP-E (reduced for faster response)
-                            time.sleep(0.005)  # 5ms (reduced from 30ms)
+
+                if streaming:
+                    # === STREAMING MODE ===
+                    # Telemetry arrives asynchronously via the stream reader;
+                    # only push a command frame when setpoints change.
+                    # Setpoints come from the published snapshot - no lock
+                    snap = self.get_state_snapshot()
+                    setpoints = (
+                        snap.safety_rod,
+                        snap.shim_rod,
+                        snap.regulating_rod,
+                        snap.pump_primary_status,
+                        snap.pump_secondary_status,
+                        snap.pump_tertiary_status,
+                        snap.humid_ct1_cmd,
+                        snap.humid_ct2_cmd,
+                        snap.humid_ct3_cmd,
+                        snap.humid_ct4_cmd
+                    )
+
+                    if setpoints != last_setpoints:
+                        # Per-port lock inside UARTDevice is enough - the
+                        # ESP-E worker drives its own port concurrently
+                        if self.uart_master.send_esp_bc_setpoints(*setpoints):
+                            last_setpoints = setpoints
                         else:
-                            logger.warning("⚠️  ESP-BC update failed")
-                
-                # Send to ESP-E outside of state_lock (non-critical, can be slower)
-                # THROTTLED: Only send every 200ms to prevent buffer overflow
-                current_time = time.time()
-                if current_time - last_esp_e_update >= ESP_E_UPDATE_INTERVAL:
-                    with self.uart_lock:
-                        try:
-                            # ESP-E communication (no delay needed, throttled by interval)
-                            
-                            # Send to ESP-E (Power Indicator + Water Flow Visualization)
-                            # Only show power when turbine PWM > 50% (DC motor minimum voltage)
-                            display_power = self.state.thermal_kw if self.state.turbine_speed > 50 else 0.0
-                            logger.debug(f"Sending to ESP-E: Thermal={self.state.thermal_kw:.1f}kW (Display={display_power:.1f}kW, Turbine={self.state.turbine_speed:.1f}%), Pumps: P={self.state.pump_primary_status} S={self.state.pump_secondary_status} T={self.state.pump_tertiary_status}")
-                            self.uart_master.update_esp_e(
-                                thermal_power_kw=display_power,
-                                pump_primary_status=self.state.pump_primary_status,
-                                pump_secondary_status=self.state.pump_secondary_status,
-                                pump_tertiary_status=self.state.pump_tertiary_status
-                            )
-                            logger.debug("✓ ESP-E update success")
-                            last_esp_e_update = current_time
-                        except Exception as e:
-                            logger.debug(f"ESP-E communication error (non-critical): {e}")
-                
+                            logger.warning("⚠️  ESP-BC setpoint send failed")
+
+                    # Consume latest streamed telemetry
+                    esp_bc_data = self.uart_master.get_esp_bc_data()
+                    with self.state_lock:
+                        self.state.thermal_kw = esp_bc_data.kw_thermal
+                        self.state.turbine_speed = esp_bc_data.turbine_speed
+                    self.publish_state_snapshot()
+
+                    # Publish display setpoints for the ESP-E worker
+                    self._publish_esp_e_setpoints()
+                    continue
+
+                # === POLL/ACK MODE ===
+                # UART transaction runs against a snapshot taken before the
+                # wire I/O starts - state_lock is NOT held across the
+                # transaction, so the button/control threads never stall
+                # behind a slow or retrying UART exchange
+                snap = self.get_state_snapshot()
+
+                # Send to ESP-BC (Control Rods + Pumps + Turbine + Humidifier)
+                # HotLog captures the raw ints only - formatting and
+                # rate limiting happen on the drain thread, not here
+                hotlog.record(logging.INFO, 'panel.tx_bc',
+                              "TX /dev/ttyAMA0: rods=[%d,%d,%d] pumps=[%d,%d,%d] humid_ct=[%d,%d,%d,%d]",
+                              snap.safety_rod, snap.shim_rod, snap.regulating_rod,
+                              snap.pump_primary_status, snap.pump_secondary_status,
+                              snap.pump_tertiary_status,
+                              snap.humid_ct1_cmd, snap.humid_ct2_cmd,
+                              snap.humid_ct3_cmd, snap.humid_ct4_cmd)
+
+                if not self.uart_master.esp_bc_connected:
+                    logger.warning("⚠️  ESP-BC not connected, skipping UART send")
+                    success = False
+                else:
+                    success = self.uart_master.update_esp_bc(
+                        snap.safety_rod,
+                        snap.shim_rod,
+                        snap.regulating_rod,
+                        snap.pump_primary_status,
+                        snap.pump_secondary_status,
+                        snap.pump_tertiary_status,
+                        snap.humid_ct1_cmd,
+                        snap.humid_ct2_cmd,
+                        snap.humid_ct3_cmd,
+                        snap.humid_ct4_cmd
+                    )
+
+                if success:
+                    logger.debug("✓ ESP-BC update success")
+                    # Get data back from ESP-BC - brief lock for the
+                    # telemetry write-back only, then republish
+                    esp_bc_data = self.uart_master.get_esp_bc_data()
+                    with self.state_lock:
+                        self.state.thermal_kw = esp_bc_data.kw_thermal
+                        self.state.turbine_speed = esp_bc_data.turbine_speed
+                    self.publish_state_snapshot()
+                else:
+                    logger.warning("⚠️  ESP-BC update failed")
+
+                # Publish display setpoints for the ESP-E worker (its own
+                # thread and port - an ESP-E timeout can't delay this loop)
+                self._publish_esp_e_setpoints()
+
             except Exception as e:
                 logger.error(f"Error in ESP communication thread: {e}")
                 import traceback
                 logger.error(traceback.format_exc())
                 time.sleep(0.1)
-        
+
         logger.info("ESP communication thread stopped")
-    
-    # ============================================
-    # Button Polling Thread
-    # ============================================
-    
-    def button_polling_thread(self):
-        """Thread for button polling (10ms cycle)"""
-        logger.info("Button polling thread started")
-        
-        loop_count = 0
+
+    def _publish_esp_e_setpoints(self):
+        """
+        Publish current display setpoints to the ESP-E worker's mailbox
+
+        Cheap (snapshot read, no I/O) - safe to call every comm cycle.
+        The worker thread drains the latest value at its own cadence.
+        """
+        snap = self.get_state_snapshot()
+        # Only show power when turbine PWM > 50% (DC motor minimum voltage)
+        display_power = snap.thermal_kw if snap.turbine_speed > 50 else 0.0
+        setpoints = (
+            display_power,
+            snap.pump_primary_status,
+            snap.pump_secondary_status,
+            snap.pump_tertiary_status
+        )
+
+        with self.esp_e_mailbox_lock:
+            self.esp_e_mailbox = setpoints
+
+    def esp_e_worker_thread(self):
+        """
+        Dedicated I/O worker for the ESP-E display link
+
+        Drains the mailbox published by esp_communication_thread and
+        drives /dev/ttyAMA3 on its own, so ESP-E transactions (and their
+        timeouts) overlap with ESP-BC traffic instead of serializing
+        behind it. ESP-E is a display peripheral - it must never delay
+        the control link.
+        """
+        logger.info("ESP-E worker thread started")
+
+        ESP_E_UPDATE_INTERVAL = 0.2  # 200ms (5x per second)
+
         while self.state.running:
             try:
-                self.button_manager.check_all_buttons()
-                time.sleep(0.005)  # 5ms polling - 2x faster for better responsiveness
-                
-                # Log heartbeat every 10 seconds (2000 loops x 5ms)
-                loop_count += 1
-                if loop_count >= 2000:
-                    logger.debug("Button polling thread: alive (2000 loops)")
-                    loop_count = 0
-                
+                time.sleep(ESP_E_UPDATE_INTERVAL)
+
+                with self.esp_e_mailbox_lock:
+                    setpoints = self.esp_e_mailbox
+
+                if setpoints is None or not self.uart_master:
+                    continue
+
+                display_power, pump_primary, pump_secondary, pump_tertiary = setpoints
+                logger.debug(f"Sending to ESP-E: Display={display_power:.1f}kW, "
+                             f"Pumps: P={pump_primary} S={pump_secondary} T={pump_tertiary}")
+                self.uart_master.update_esp_e(
+                    thermal_power_kw=display_power,
+                    pump_primary_status=pump_primary,
+                    pump_secondary_status=pump_secondary,
+                    pump_tertiary_status=pump_tertiary
+                )
+                logger.debug("✓ ESP-E update success")
+
             except Exception as e:
-                logger.error(f"Error in button polling thread: {e}")
-                import traceback
-                logger.error(traceback.format_exc())
-                time.sleep(0.05)
-        
-        logger.info("Button polling thread stopped")
-    
+                logger.debug(f"ESP-E communication error (non-critical): {e}")
+
+        logger.info("ESP-E worker thread stopped")
+
+
+    # ============================================
+    # Button Hold Repeat Thread
+    # ============================================
+    # NOTE: No polling thread anymore - presses arrive via kernel edge
+    # detection in ButtonHandler (interrupt callbacks push ButtonEvents
+    # into button_event_queue directly). Only hold repeats need a timer.
+
     def button_hold_thread(self):
-        """Thread for detecting held buttons (rod and pressure control)"""
+        """
+        Thread generating repeats for held buttons (rod/pressure control)
+
+        The initial press is already delivered by the GPIO interrupt
+        callback; this loop only walks the handler's in-memory held set
+        every 10ms to emit the 50ms repeat events.
+        """
         logger.info("Button hold detection thread started")
         
         # Define which buttons support hold
@@ -1332,7 +1521,7 @@ class PLTNPanelController:
                     elif pin == ButtonPin.PRESSURE_DOWN:
                         self.button_event_queue.put(ButtonEvent.PRESSURE_DOWN)
                 
-                time.sleep(0.01)  # 10ms polling (same as button_polling)
+                time.sleep(0.01)  # 10ms tick - walks the held set only, no GPIO scan
                 
             except Exception as e:
                 logger.error(f"Error in button hold thread: {e}")
@@ -1344,11 +1533,12 @@ class PLTNPanelController:
     
     def oled_update_thread(self):
         """
-        Thread for updating 9 OLED displays (100ms cycle - optimized for faster visual feedback)
-        
+        Thread for updating 9 OLED displays (50ms base tick)
+
         This thread handles:
         - Initial sync of interpolators to clear startup screen
-        - Continuous OLED updates at 10Hz (100ms cycle)
+        - Ticking the OLED manager's deadline scheduler at 20Hz - the
+          scheduler decides per display which ones actually refresh
         - Smooth value interpolation for better UX
         """
         logger.info("OLED update thread started")
@@ -1362,19 +1552,23 @@ class PLTNPanelController:
         
         while self.state.running:
             try:
-                with self.state_lock:
-                    if first_update:
-                        # FIRST UPDATE: Sync interpolators to current state and force display update
-                        # This clears the "Siap" startup screen and shows actual values
-                        logger.info("OLED Thread: Performing first update to clear startup screen...")
-                        self.oled_manager.sync_interpolators_to_state(self.state)
-                        first_update = False
-                        logger.info("OLED Thread: First update complete, entering normal update loop")
-                    else:
-                        # NORMAL UPDATE: Update all 9 OLED displays with smooth interpolation
-                        self.oled_manager.update_all(self.state)
-                
-                time.sleep(0.1)  # 100ms update rate (10Hz for smooth interpolation)
+                # Lock-free: render from the published snapshot so a slow
+                # I2C refresh (9 displays) never blocks writer threads
+                snap = self.get_state_snapshot()
+
+                if first_update:
+                    # FIRST UPDATE: Sync interpolators to current state and force display update
+                    # This clears the "Siap" startup screen and shows actual values
+                    logger.info("OLED Thread: Performing first update to clear startup screen...")
+                    self.oled_manager.sync_interpolators_to_state(snap)
+                    first_update = False
+                    logger.info("OLED Thread: First update complete, entering normal update loop")
+                else:
+                    # NORMAL UPDATE: deadline scheduler inside update_all
+                    # decides which displays actually need servicing
+                    self.oled_manager.update_all(snap)
+
+                time.sleep(0.05)  # 50ms base tick (20Hz) - animating displays need it
                 
             except Exception as e:
                 # Don't spam logs with OLED errors - it's not critical
@@ -1802,11 +1996,11 @@ class PLTNPanelController:
         
         # Start threads
         threads = [
-            threading.Thread(target=self.button_polling_thread, daemon=True, name="ButtonThread"),
             threading.Thread(target=self.button_hold_thread, daemon=True, name="ButtonHoldThread"),
             threading.Thread(target=self.button_event_processor_thread, daemon=True, name="EventThread"),
             threading.Thread(target=self.control_logic_thread, daemon=True, name="ControlThread"),
             threading.Thread(target=self.esp_communication_thread, daemon=True, name="ESPCommThread"),
+            threading.Thread(target=self.esp_e_worker_thread, daemon=True, name="ESPEWorkerThread"),
             threading.Thread(target=self.oled_update_thread, daemon=True, name="OLEDThread"),
             threading.Thread(target=self.health_monitoring_thread, daemon=True, name="HealthThread"),
             threading.Thread(target=self.auto_simulation_thread, daemon=True, name="AutoSimThread"),  # NEW
@@ -1821,21 +2015,21 @@ class PLTNPanelController:
             while self.state.running:
                 time.sleep(1.0)
                 
-                # Print status every second
-                with self.state_lock:
+                # Print status every second (snapshot read - no lock)
+                snap = self.get_state_snapshot()
+                if self.uart_master:
                     # Get turbine data from ESP-BC
-                    if self.uart_master:
-                        esp_bc_data = self.uart_master.get_esp_bc_data()
-                        
-                        logger.info(f"Status: P={self.state.pressure:.1f}bar, "
-                                  f"Rods=[{self.state.safety_rod},{self.state.shim_rod},"
-                                  f"{self.state.regulating_rod}]%, "
-                                  f"Thermal={self.state.thermal_kw:.1f}kW, "
-                                  f"Turbine={esp_bc_data.power_level:.1f}%, "
-                                  f"Humid=[CT:{self.state.humid_ct1_cmd},{self.state.humid_ct2_cmd},"\
-                                  f"{self.state.humid_ct3_cmd},{self.state.humid_ct4_cmd}]")
-                    else:
-                        logger.info(f"Status: P={self.state.pressure:.1f}bar (Simulation mode)")
+                    esp_bc_data = self.uart_master.get_esp_bc_data()
+
+                    logger.info(f"Status: P={snap.pressure:.1f}bar, "
+                              f"Rods=[{snap.safety_rod},{snap.shim_rod},"
+                              f"{snap.regulating_rod}]%, "
+                              f"Thermal={snap.thermal_kw:.1f}kW, "
+                              f"Turbine={esp_bc_data.power_level:.1f}%, "
+                              f"Humid=[CT:{snap.humid_ct1_cmd},{snap.humid_ct2_cmd},"\
+                              f"{snap.humid_ct3_cmd},{snap.humid_ct4_cmd}]")
+                else:
+                    logger.info(f"Status: P={snap.pressure:.1f}bar (Simulation mode)")
                 
         except KeyboardInterrupt:
             logger.info("Keyboard interrupt received")
@@ -1843,77 +2037,97 @@ class PLTNPanelController:
             self.shutdown()
     
     def health_monitoring_thread(self):
-        """Thread for system health monitoring - disabled (already done in __init__)"""
-        logger.info("Health monitoring: Initial check already completed during initialization")
-        
-        # Health check already done in __init__ (line 173)
-        # No need to run it again here - this was causing duplicate checks
-        # 
-        # Original code (now disabled):
-        # try:
-        #     time.sleep(2.0)  # Wait for system to stabilize
-        #     logger.info("\n" + "="*70)
-        #     logger.info("INITIAL SYSTEM HEALTH CHECK")
-        #     logger.info("="*70)
-        #     with self.uart_lock:
-        #         self.health_monitor.check_all(self)
-        #     logger.info("Initial health check complete - periodic checks disabled")
-        # except Exception as e:
-        #     logger.error(f"Initial health check error: {e}")
-        
-        # Thread stays alive but does nothing (just sleeps)
+        """
+        Thread for incremental system health monitoring
+
+        The comprehensive check_all sweep runs once during __init__,
+        BEFORE the control threads start - so it can't contend with the
+        live control path. At runtime this thread asks the monitor for
+        AT MOST ONE due component check per second: each check is a
+        small task with its own interval and time budget, results land
+        in the cached ComponentHealth table that get_summary reads
+        instantly. No more periodic 8-check sweep holding the shared
+        I2C buses and UART ports for hundreds of milliseconds.
+        """
+        logger.info("Health monitoring thread started (incremental, one check per tick)")
+
+        # Let the system stabilize before the first periodic check
+        time.sleep(5.0)
+
         while self.state.running:
-            time.sleep(60.0)  # Just keep thread alive
-        
+            try:
+                # Bus-idle gap: if a button event just requested an
+                # immediate ESP send, don't put a health transaction in
+                # front of it - next second is fine
+                if not self.esp_send_immediate.is_set():
+                    self.health_monitor.tick(self)
+            except Exception as e:
+                logger.error(f"Health monitoring error: {e}")
+            time.sleep(1.0)
+
         logger.info("Health monitoring thread stopped")
     
     def state_export_thread(self):
         """
-        Export state to JSON file for video display integration
-        Updates every 100ms (10 Hz) - sufficient for UI updates
+        Export state for video display integration
+
+        Primary: binary shared-memory channel (seqlock struct in
+        /dev/shm) at 20 Hz - one memcpy per update, no filesystem churn.
+        Fallback: legacy 10 Hz JSON temp-file + atomic rename when
+        shared memory is unavailable.
         """
-        logger.info("State export thread started (for video display)")
-        logger.info(f"   Export file: {self.state_export_file}")
-        
+        use_shm = self.state_shm_writer is not None
+        if use_shm:
+            logger.info("State export thread started (shared memory, 20 Hz)")
+        else:
+            logger.info("State export thread started (JSON fallback, 10 Hz)")
+            logger.info(f"   Export file: {self.state_export_file}")
+
         try:
             while self.state.running:
                 try:
-                    with self.state_lock:
-                        # Prepare state dict for JSON export
-                        state_dict = {
-                            "timestamp": time.time(),
-                            "mode": self.state.simulation_mode,
-                            "auto_running": self.state.auto_sim_running,
-                            "auto_phase": self.state.auto_sim_phase,
-                            "pressure": float(self.state.pressure),
-                            "safety_rod": int(self.state.safety_rod),
-                            "shim_rod": int(self.state.shim_rod),
-                            "regulating_rod": int(self.state.regulating_rod),
-                            "pump_primary": int(self.state.pump_primary_status),
-                            "pump_secondary": int(self.state.pump_secondary_status),
-                            "pump_tertiary": int(self.state.pump_tertiary_status),
-                            "thermal_kw": float(self.state.thermal_kw),
-                            "turbine_speed": float(self.state.turbine_speed),
-                            "emergency": bool(self.state.emergency_active)
-                        }
-                    
-                    # Write to file (atomic write with temp file)
-                    temp_file = self.state_export_file.with_suffix('.tmp')
-                    with open(temp_file, 'w') as f:
-                        json.dump(state_dict, f, indent=2)
-                    
-                    # Atomic rename (prevents partial reads)
-                    temp_file.replace(self.state_export_file)
-                
+                    # Snapshot read - consistent copy, no state_lock needed
+                    snap = self.get_state_snapshot()
+
+                    # Prepare state dict for export (same keys both channels)
+                    state_dict = {
+                        "timestamp": time.time(),
+                        "mode": snap.simulation_mode,
+                        "auto_running": snap.auto_sim_running,
+                        "auto_phase": snap.auto_sim_phase,
+                        "pressure": float(snap.pressure),
+                        "safety_rod": int(snap.safety_rod),
+                        "shim_rod": int(snap.shim_rod),
+                        "regulating_rod": int(snap.regulating_rod),
+                        "pump_primary": int(snap.pump_primary_status),
+                        "pump_secondary": int(snap.pump_secondary_status),
+                        "pump_tertiary": int(snap.pump_tertiary_status),
+                        "thermal_kw": float(snap.thermal_kw),
+                        "turbine_speed": float(snap.turbine_speed),
+                        "emergency": bool(snap.emergency_active)
+                    }
+
+                    if use_shm:
+                        self.state_shm_writer.write(state_dict)
+                    else:
+                        # Write to file (atomic write with temp file)
+                        temp_file = self.state_export_file.with_suffix('.tmp')
+                        with open(temp_file, 'w') as f:
+                            json.dump(state_dict, f, indent=2)
+
+                        # Atomic rename (prevents partial reads)
+                        temp_file.replace(self.state_export_file)
+
                 except Exception as e:
                     logger.error(f"State export error: {e}")
-                
-                # Update rate: 100ms = 10 Hz (sufficient for UI)
-                time.sleep(0.1)
-        
+
+                # shm: 50ms = 20 Hz (full control rate, export is ~µs)
+                # JSON: 100ms = 10 Hz (sufficient for UI)
+                time.sleep(0.05 if use_shm else 0.1)
+
         except Exception as e:
             logger.error(f"State export thread crashed: {e}")
-        
+
         logger.info("State export thread stopped")
     
     def shutdown(self):
@@ -1975,7 +2189,27 @@ class PLTNPanelController:
                 self.mux_manager.close()
         except Exception as e:
             logger.error(f"Error closing multiplexers: {e}")
-        
+
+        try:
+            # 5. Close shared-memory state export
+            if self.state_shm_writer:
+                self.state_shm_writer.close()
+        except Exception as e:
+            logger.error(f"Error closing state export: {e}")
+
+        try:
+            # 6. Close flight recorder (ring file stays for analysis)
+            if self.flight_recorder:
+                self.flight_recorder.close()
+        except Exception as e:
+            logger.error(f"Error closing flight recorder: {e}")
+
+        try:
+            # 7. Drain any buffered hot-path log entries
+            hotlog.stop()
+        except Exception as e:
+            logger.error(f"Error draining hot log: {e}")
+
         logger.info("="*60)
         logger.info("✅ PLTN Panel Controller shutdown complete")
         logger.info("="*60)
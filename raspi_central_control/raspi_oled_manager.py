@@ -86,6 +86,18 @@ class DisplayValueInterpolator:
         self.last_update_time = current_time
         return int(round(self.current_value))
     
+    def is_animating(self):
+        """
+        Check if interpolator is mid-transition (current != target)
+
+        Used by the deadline scheduler to promote a display to its
+        animation refresh rate while a value is still moving.
+
+        Returns:
+            True while the displayed value hasn't reached the target
+        """
+        return abs(self.current_value - self.target_value) > 0.5
+
     def needs_update(self):
         """
         Check if display needs update (value changed since last display)
@@ -145,7 +157,12 @@ class OLEDDisplay:
             self.font_xlarge = ImageFont.load_default()
         
         self.initialized = False
-    
+
+        # Page-diff transmission state: copy of the framebuffer as last
+        # sent to the panel. None = next show() must do a full flush
+        # (first frame after init, or recovery after an I2C error).
+        self.last_buffer = None
+
     def init_hardware(self, i2c, address: int = 0x3C, timeout: float = 1.0):
         """
         Initialize hardware OLED display with timeout
@@ -229,13 +246,89 @@ class OLEDDisplay:
                                   outline=255, fill=255)
     
     def show(self):
-        """Update display"""
+        """
+        Update display - transmits only the changed SSD1306 pages
+
+        The full 128x32 framebuffer is 512 bytes over I2C; a typical
+        update changes only a 3-digit number, so diffing against the
+        last-transmitted buffer and writing just the changed 8-pixel
+        page spans (with column addressing) cuts most updates to well
+        under 100 bytes. Falls back to a full flush on the first frame
+        and after any I2C error.
+        """
         if self.initialized and self.device:
             try:
                 self.device.image(self.image)
-                self.device.show()
+                self._flush_diff()
             except Exception as e:
                 logger.error(f"Failed to update display: {e}")
+                self.last_buffer = None  # Force full flush on recovery
+
+    def _flush_diff(self):
+        """Send changed page spans only; full flush when cheaper/needed"""
+        # Adafruit SSD1306_I2C keeps [0x40 control byte][page-major data]
+        raw = getattr(self.device, 'buffer', None)
+        if raw is None or raw[0] != 0x40:
+            # Unexpected driver internals - plain full flush
+            self.device.show()
+            self.last_buffer = None
+            return
+
+        data = bytes(raw[1:])
+
+        if self.last_buffer is None or len(self.last_buffer) != len(data):
+            # First frame (or driver re-init) - full flush
+            self.device.show()
+            self.last_buffer = data
+            return
+
+        if data == self.last_buffer:
+            return  # Nothing changed - no I2C traffic at all
+
+        # Collect changed column span per 8-pixel page
+        pages = self.height // 8
+        spans = []
+        changed_bytes = 0
+        for page in range(pages):
+            start = page * self.width
+            new = data[start:start + self.width]
+            old = self.last_buffer[start:start + self.width]
+            if new == old:
+                continue
+            c0 = next(i for i in range(self.width) if new[i] != old[i])
+            c1 = next(i for i in range(self.width - 1, -1, -1) if new[i] != old[i])
+            spans.append((page, c0, c1, new[c0:c1 + 1]))
+            changed_bytes += (c1 - c0 + 1)
+
+        # If most of the frame changed, one full flush is cheaper than
+        # per-page addressing commands
+        if changed_bytes > (self.width * pages) // 2:
+            self.device.show()
+        else:
+            for page, c0, c1, chunk in spans:
+                self._write_page_span(page, c0, c1, chunk)
+
+        self.last_buffer = data
+
+    def _write_page_span(self, page, col_start, col_end, chunk):
+        """Write one changed span: set column/page window, then data"""
+        SET_COL_ADDR = 0x21
+        SET_PAGE_ADDR = 0x22
+
+        # Narrow panels are centered in the 128-column GDDRAM
+        col_offset = (128 - self.width) // 2 if self.width != 128 else 0
+
+        dev = self.device
+        dev.write_cmd(SET_COL_ADDR)
+        dev.write_cmd(col_start + col_offset)
+        dev.write_cmd(col_end + col_offset)
+        dev.write_cmd(SET_PAGE_ADDR)
+        dev.write_cmd(page)
+        dev.write_cmd(page)
+
+        # Data transfer: Co=0, D/C=1 control byte then payload
+        with dev.i2c_device:
+            dev.i2c_device.write(bytes([0x40]) + chunk)
 
 
 class OLEDManager:
@@ -282,6 +375,13 @@ class OLEDManager:
         
         self.blink_state = False
         self.last_blink_time = time.time()
+
+        # Render-then-flush scheduler: update_* methods only draw into
+        # their PIL buffers and queue (channel -> display) here; the
+        # flush stage walks each mux's channels in ascending order and
+        # selects every channel exactly once per cycle
+        self.pending_mux1 = {}
+        self.pending_mux2 = {}
         
         # System status display state tracking
         self.status_mode_shown = False      # Track if mode already shown
@@ -311,12 +411,107 @@ class OLEDManager:
         self.interp_shim_rod = DisplayValueInterpolator(speed=50.0, name="shim_rod")
         self.interp_regulating_rod = DisplayValueInterpolator(speed=50.0, name="regulating_rod")
         self.interp_thermal_power = DisplayValueInterpolator(speed=50000.0, name="thermal_kw")  # kW scale
-        
+
+        # Deadline scheduler: next service time per logical display.
+        # 0.0 = due immediately on first cycle
+        self.display_deadlines = {
+            'pressurizer': 0.0,
+            'pump_primary': 0.0,
+            'pump_secondary': 0.0,
+            'pump_tertiary': 0.0,
+            'safety_rod': 0.0,
+            'shim_rod': 0.0,
+            'regulating_rod': 0.0,
+            'thermal_power': 0.0,
+            'system_status': 0.0
+        }
+
+        # Lazy init retry state: displays that were absent/flaky at boot
+        # get probed again from the update cycle instead of blocking boot
+        self.failed_displays = []  # (mux_id, channel, display, name)
+        self.last_init_retry = 0.0
+        self._i2c = None  # Kept after init_all_displays for lazy retries
+
         logger.info("OLED Manager initialized for 9 displays (128x32)")
         logger.info("Display interpolation enabled: 50 units/sec for smooth transitions")
-    
+
+    # Seconds between lazy re-init attempts for absent displays
+    INIT_RETRY_INTERVAL = 10.0
+
+    # Deadline scheduler refresh periods (seconds)
+    PERIOD_ANIMATING = 0.05     # 20Hz while an interpolator is mid-transition
+    PERIOD_INTERPOLATED = 0.20  # Idle rate for interpolated readouts
+    PERIOD_STATUS = 0.25        # System status (drives its own blink cycles)
+    PERIOD_STATIC = 0.50        # Pump status readouts (dirty-flag driven)
+
+    # Max I2C time spent transmitting per update cycle - leftovers stay
+    # queued and go out next cycle, so one slow display can't starve the
+    # animation cadence of the others
+    FLUSH_BUDGET_S = 0.060
+
+    @staticmethod
+    def _probe_address(i2c, address: int) -> bool:
+        """
+        Cheap presence probe (bus scan ACK test, no SSD1306 init)
+
+        An absent display fails here in a few ms instead of burning the
+        full 0.5s init timeout.
+        """
+        try:
+            if i2c.try_lock():
+                try:
+                    return address in i2c.scan()
+                finally:
+                    i2c.unlock()
+        except Exception:
+            pass
+        return True  # Probe inconclusive - let init_hardware decide
+
+    def _init_one_display(self, i2c, mux_id: int, channel: int,
+                          display: OLEDDisplay, name: str) -> bool:
+        """
+        Probe + initialize a single display on its mux channel
+
+        Returns:
+            True if the display is up, False if absent/failed
+        """
+        oled_no = channel if mux_id == 1 else channel + 7
+
+        if mux_id == 1:
+            self.mux.select_display_channel(channel)  # 10ms settle inside
+        else:
+            self.mux.select_esp_channel(channel)
+
+        # Fast probe first - absent displays cost ~ms, not the timeout
+        if not self._probe_address(i2c, 0x3C):
+            logger.warning(f"  ✗ OLED #{oled_no}: {name} - not detected")
+            return False
+
+        # Try to initialize with 0.5s timeout per display
+        if display.init_hardware(i2c, 0x3C, timeout=0.5):
+            # Show startup message (2 lines, larger font)
+            display.clear()
+            display.draw_text_centered(name, 4, display.font)
+            display.draw_text_centered("Siap", 18, display.font_large)
+            display.show()
+            logger.info(f"  ✓ OLED #{oled_no}: {name}")
+            return True
+
+        logger.warning(f"  ✗ OLED #{oled_no}: {name} - init failed")
+        return False
+
     def init_all_displays(self):
-        """Initialize all 9 OLED displays through 2x TCA9548A with graceful degradation"""
+        """
+        Initialize all 9 OLED displays through 2x TCA9548A
+
+        Fast-boot strategy: each channel gets a cheap address probe
+        before the expensive SSD1306 init, so absent or dead displays
+        cost milliseconds instead of the full per-display timeout. They
+        are queued for lazy retry from the update cycle rather than
+        blocking boot. (Both muxes hang off the same physical I2C bus,
+        so per-display init cannot truly overlap - the probe is what
+        makes the serial walk fast.)
+        """
         # TCA9548A #1 (0x70) - 7 displays
         displays_mux1 = [
             (1, self.oled_pressurizer, "Pressurizer"),
@@ -327,74 +522,73 @@ class OLEDManager:
             (6, self.oled_shim_rod, "Shim Rod"),
             (7, self.oled_regulating_rod, "Reg Rod")
         ]
-        
+
         # TCA9548A #2 (0x71) - 2 displays
         displays_mux2 = [
             (1, self.oled_thermal_power, "Daya"),
             (2, self.oled_system_status, "Status")
         ]
-        
+
         if not ADAFRUIT_AVAILABLE:
             logger.warning("Running without hardware displays (simulation mode)")
             return
-        
+
         success_count = 0
-        
+
         try:
             i2c = board.I2C()
-            
-            # Initialize displays on TCA9548A #1 (0x70)
-            logger.info("Initializing OLEDs on TCA9548A #1 (0x70)...")
-            for channel, display, name in displays_mux1:
-                try:
-                    self.mux.select_display_channel(channel)
-                    time.sleep(0.05)  # Minimal delay
-                    
-                    # Try to initialize with 0.5s timeout per display
-                    if display.init_hardware(i2c, 0x3C, timeout=0.5):
-                        # Show startup message (2 lines, larger font)
-                        display.clear()
-                        display.draw_text_centered(name, 4, display.font)
-                        display.draw_text_centered("Siap", 18, display.font_large)
-                        display.show()
-                        logger.info(f"  ✓ OLED #{channel}: {name}")
-                        success_count += 1
-                    else:
-                        logger.warning(f"  ✗ OLED #{channel}: {name} - skipped")
-                    
-                except Exception as e:
-                    logger.warning(f"  ✗ OLED #{channel}: {name} - error: {e}")
-                    continue  # Skip to next display
-            
-            # Initialize displays on TCA9548A #2 (0x71)
-            logger.info("Initializing OLEDs on TCA9548A #2 (0x71)...")
-            for channel, display, name in displays_mux2:
-                try:
-                    # Use esp_channel to access second multiplexer (0x71)
-                    self.mux.select_esp_channel(channel)
-                    time.sleep(0.05)  # Minimal delay
-                    
-                    # Try to initialize with 0.5s timeout per display
-                    if display.init_hardware(i2c, 0x3C, timeout=0.5):
-                        # Show startup message (2 lines, larger font)
-                        display.clear()
-                        display.draw_text_centered(name, 4, display.font)
-                        display.draw_text_centered("Siap", 18, display.font_large)
-                        display.show()
-                        logger.info(f"  ✓ OLED #{channel + 7}: {name}")
-                        success_count += 1
-                    else:
-                        logger.warning(f"  ✗ OLED #{channel + 7}: {name} - skipped")
-                    
-                except Exception as e:
-                    logger.warning(f"  ✗ OLED #{channel + 7}: {name} - error: {e}")
-                    continue  # Skip to next display
-            
+            self._i2c = i2c  # Kept for lazy background retries
+
+            for mux_id, entries in ((1, displays_mux1), (2, displays_mux2)):
+                logger.info(f"Initializing OLEDs on TCA9548A #{mux_id}...")
+                for channel, display, name in entries:
+                    try:
+                        if self._init_one_display(i2c, mux_id, channel, display, name):
+                            success_count += 1
+                        else:
+                            self.failed_displays.append((mux_id, channel, display, name))
+                    except Exception as e:
+                        logger.warning(f"  ✗ OLED init error ({name}): {e}")
+                        self.failed_displays.append((mux_id, channel, display, name))
+                        continue  # Skip to next display
+
             logger.info(f"OLED initialization complete: {success_count}/9 displays ready")
-            
+            if self.failed_displays:
+                logger.info(f"   {len(self.failed_displays)} display(s) absent - "
+                            f"lazy retry every {self.INIT_RETRY_INTERVAL:.0f}s")
+
         except Exception as e:
             logger.error(f"Failed to initialize displays: {e}")
             logger.warning("Continuing without OLED displays...")
+
+    def _retry_failed_displays(self):
+        """
+        Lazy re-init of displays that were absent at boot
+
+        Called from update_all on the OLED thread (same thread as all
+        other display I2C traffic - no locking needed). Rate-limited to
+        one display per INIT_RETRY_INTERVAL so a missing panel costs a
+        few ms every 10s, not every cycle.
+        """
+        if not self.failed_displays or self._i2c is None:
+            return
+
+        now = time.time()
+        if now - self.last_init_retry < self.INIT_RETRY_INTERVAL:
+            return
+        self.last_init_retry = now
+
+        mux_id, channel, display, name = self.failed_displays[0]
+        try:
+            if self._init_one_display(self._i2c, mux_id, channel, display, name):
+                self.failed_displays.pop(0)
+                logger.info(f"✅ OLED recovered: {name}")
+            else:
+                # Still absent - rotate to the back of the queue
+                self.failed_displays.append(self.failed_displays.pop(0))
+        except Exception as e:
+            logger.debug(f"OLED retry failed ({name}): {e}")
+            self.failed_displays.append(self.failed_displays.pop(0))
     
     def update_blink_state(self, interval: float = 0.25):
         """Update blink state for warning indicators"""
@@ -422,19 +616,16 @@ class OLEDManager:
         # OPTIMIZATION: Only update I2C if value changed
         if not self.interp_pressure.needs_update():
             return  # Skip I2C call - no visual change
-        
-        # === I2C COMMUNICATION (timing preserved) ===
-        self.mux.select_display_channel(1)  # Pressurizer on channel 1 (10ms delay inside)
-        
+
+        # === RENDER ONLY - transmission happens in _flush_pending() ===
         display = self.oled_pressurizer
         display.clear()
-        
+
         # Show smoothly interpolated value with large font
         pressure_text = f"{display_pressure:.1f} bar"
         display.draw_text_centered(pressure_text, 8, display.font_xlarge)
-        
-        display.show()
-        time.sleep(0.005)  # 5ms delay after show() - PRESERVED
+
+        self.pending_mux1[1] = display  # Pressurizer on channel 1
     
     def update_pump_display(self, pump_name: str, channel: int, display_obj: OLEDDisplay,
                            status: int, pwm: int):
@@ -454,18 +645,15 @@ class OLEDManager:
             return  # No change, skip I2C call
         
         self.last_data[cache_key] = status
-        
-        # === I2C COMMUNICATION (timing preserved) ===
-        self.mux.select_display_channel(channel)  # 10ms delay inside
-        
+
+        # === RENDER ONLY - transmission happens in _flush_pending() ===
         display_obj.clear()
-        
+
         # Show only status in Indonesian with large font (panel already has label)
         status_text = ["MATI", "MULAI", "HIDUP", "BERHENTI"][status]
         display_obj.draw_text_centered(status_text, 8, display_obj.font_xlarge)
-        
-        display_obj.show()
-        time.sleep(0.005)  # 5ms delay after show() - PRESERVED
+
+        self.pending_mux1[channel] = display_obj
     
     def update_pump_primary(self, status: int, pwm: int):
         """Update primary pump display"""
@@ -500,18 +688,15 @@ class OLEDManager:
         # OPTIMIZATION: Only update I2C if value changed
         if not interpolator.needs_update():
             return  # Skip I2C call - no visual change
-        
-        # === I2C COMMUNICATION (timing preserved) ===
-        self.mux.select_display_channel(channel)  # 10ms delay inside
-        
+
+        # === RENDER ONLY - transmission happens in _flush_pending() ===
         display_obj.clear()
-        
+
         # Show smoothly interpolated percentage value
         position_text = f"{display_position}%"
         display_obj.draw_text_centered(position_text, 8, display_obj.font_xlarge)
-        
-        display_obj.show()
-        time.sleep(0.005)  # 5ms delay after show() - PRESERVED
+
+        self.pending_mux1[channel] = display_obj
     
     def update_safety_rod(self, position: int):
         """Update safety rod display with interpolation"""
@@ -524,9 +709,6 @@ class OLEDManager:
     def update_regulating_rod(self, position: int):
         """Update regulating rod display with interpolation"""
         self.update_rod_display("REGULATING", 7, self.oled_regulating_rod, position, self.interp_regulating_rod)
-        # Extra delay: This is the LAST channel on MUX #1 (channel 7)
-        # Give OLED time to fully process before switching to MUX #2
-        time.sleep(0.010)  # 10ms post-update delay - PRESERVED
     
     def update_thermal_power(self, power_kw: float):
         """
@@ -545,20 +727,17 @@ class OLEDManager:
         # This prevents excessive updates for small thermal fluctuations
         if not self.interp_thermal_power.needs_update():
             return  # Skip I2C call - no visual change
-        
-        # === I2C COMMUNICATION (timing preserved) ===
-        self.mux.select_esp_channel(1)  # Use ESP channel for TCA9548A #2, Channel 1 (10ms delay inside)
-        
+
+        # === RENDER ONLY - transmission happens in _flush_pending() ===
         display = self.oled_thermal_power
         display.clear()
-        
+
         # Show smoothly interpolated power value
         power_mwe = display_power_kw / 1000.0
         power_text = f"{power_mwe:.1f} MWe"
         display.draw_text_centered(power_text, 8, display.font_xlarge)
-        
-        display.show()
-        time.sleep(0.005)  # 5ms delay after show() - PRESERVED
+
+        self.pending_mux2[1] = display  # TCA9548A #2, Channel 1
     
     def _is_system_idle(self, pressure: float, pump_primary: int, pump_secondary: int,
                        pump_tertiary: int, safety_rod: int, shim_rod: int,
@@ -801,9 +980,8 @@ class OLEDManager:
             turbine_speed: Turbine speed percentage
             emergency_active: Emergency shutdown flag
         """
-        # Select channel
-        self.mux.select_esp_channel(2)  # Use ESP channel for TCA9548A #2, Channel 2
-        
+        # Render only - transmission (TCA9548A #2, Channel 2) happens
+        # in _flush_pending()
         display = self.oled_system_status
         display.clear()
         
@@ -822,10 +1000,8 @@ class OLEDManager:
                 display.draw_text_centered("EMERGENCY", 6, display.font_large)
                 display.draw_text_centered("SISTEM SHUTDOWN", 22, display.font_small)
             # else: Blink OFF: Display remains blank (cleared above)
-            
-            display.show()
-            time.sleep(0.005)
-            time.sleep(0.010)
+
+            self.pending_mux2[2] = display
             return  # Skip normal display logic
         
         # ============================================
@@ -845,9 +1021,8 @@ class OLEDManager:
         if not self.status_mode_shown:
             # Show mode indicator only once when mode changes
             display.draw_text_centered(current_mode, 10, display.font_xlarge)
-            display.show()
-            time.sleep(0.005)
-            
+            self.pending_mux2[2] = display
+
             # Mark as shown after first display
             self.status_mode_shown = True
             return
@@ -923,16 +1098,8 @@ class OLEDManager:
                 if line2:
                     display.draw_text_centered(line2, 20, display.font_small)
         
-        display.show()
-        time.sleep(0.005)  # 5ms delay after show() - PRESERVED
-        
-        # Post-update delay for MUX #2
-        time.sleep(0.010)  # 10ms post-update delay
-        
-        # Extra delay: This is the LAST channel on MUX #2 (channel 2)
-        # Give OLED time to fully process before next update cycle
-        time.sleep(0.010)  # 10ms post-update delay
-    
+        self.pending_mux2[2] = display
+
     def reset_all_interpolators(self):
         """
         Reset all interpolators to zero (instant, no transition).
@@ -998,52 +1165,131 @@ class OLEDManager:
         self.update_all(state)
         logger.info("Startup screen cleared, displays now show actual values")
     
+    def _flush_pending(self, show_delay: float = 0.005):
+        """
+        Flush rendered frames, grouped per mux channel, within a budget
+
+        Stage 2 of the render-then-flush scheduler: the update_* methods
+        above only draw into their PIL buffers and queue displays here.
+        Channels are walked in ascending order with each selected exactly
+        once per pass, so the TCA9548A channel register never ping-pongs
+        and the cross-mux switch (with its 15ms guard) happens at most
+        once per pass instead of per display.
+
+        Transmission stops once FLUSH_BUDGET_S of I2C time is spent;
+        whatever is left stays queued (with its latest rendered frame)
+        and goes out on the next cycle.
+
+        Args:
+            show_delay: Post-show settle delay per display (5ms preserved)
+        """
+        start = time.time()
+
+        for channel in sorted(self.pending_mux1):
+            if time.time() - start > self.FLUSH_BUDGET_S:
+                return  # Budget spent - leftovers transmit next cycle
+            self.mux.select_display_channel(channel)  # 10ms settle inside
+            self.pending_mux1[channel].show()
+            time.sleep(show_delay)
+            del self.pending_mux1[channel]
+
+        if self.pending_mux2:
+            if time.time() - start > self.FLUSH_BUDGET_S:
+                return
+
+            # Give the last MUX #1 OLED time before the cross-mux switch
+            time.sleep(0.010)
+
+            for channel in sorted(self.pending_mux2):
+                if time.time() - start > self.FLUSH_BUDGET_S:
+                    return
+                self.mux.select_esp_channel(channel)  # 10ms settle inside
+                self.pending_mux2[channel].show()
+                time.sleep(show_delay)
+                del self.pending_mux2[channel]
+
+    def _display_period(self, name: str) -> float:
+        """
+        Desired refresh period for a logical display right now
+
+        Interpolated readouts are promoted to the 20Hz animation rate
+        while their interpolator is mid-transition and relax back to the
+        idle rate once the value settles.
+        """
+        interp = {
+            'pressurizer': self.interp_pressure,
+            'safety_rod': self.interp_safety_rod,
+            'shim_rod': self.interp_shim_rod,
+            'regulating_rod': self.interp_regulating_rod,
+            'thermal_power': self.interp_thermal_power
+        }.get(name)
+
+        if interp is not None:
+            return self.PERIOD_ANIMATING if interp.is_animating() else self.PERIOD_INTERPOLATED
+        if name == 'system_status':
+            return self.PERIOD_STATUS
+        return self.PERIOD_STATIC
+
     def update_all(self, state):
         """
-        Update all displays from panel state
-        
+        Service displays by deadline from panel state
+
+        Deadline scheduler: each logical display has a desired refresh
+        period (animation-aware via DisplayValueInterpolator) and is
+        rendered when its deadline comes due, earliest deadline first.
+        Rendering queues a frame only when the content actually changed
+        (dirty detection lives in the update_* methods), and the flush
+        stage transmits within an I2C time budget - so animating
+        displays get their 20Hz while static readouts produce near-zero
+        bus traffic.
+
         Args:
             state: PanelState object with all current values
         """
         self.update_blink_state()
-        
-        # ============================================
-        # MUX #1 (0x70) - Channels 1-7
-        # ============================================
-        
-        # Update all displays on MUX #1
-        self.update_pressurizer_display(state.pressure, 
-                                       warning=(state.pressure > 180),
-                                       critical=(state.pressure > 195))
-        
-        self.update_pump_primary(state.pump_primary_status, 50)  # PWM placeholder
-        self.update_pump_secondary(state.pump_secondary_status, 50)
-        self.update_pump_tertiary(state.pump_tertiary_status, 50)
-        
-        self.update_safety_rod(state.safety_rod)
-        self.update_shim_rod(state.shim_rod)
-        self.update_regulating_rod(state.regulating_rod)
-        
+
+        # Lazy re-init of displays that were absent at boot (rate-limited)
+        self._retry_failed_displays()
+
+        renderers = {
+            'pressurizer': lambda: self.update_pressurizer_display(
+                state.pressure,
+                warning=(state.pressure > 180),
+                critical=(state.pressure > 195)),
+            'pump_primary': lambda: self.update_pump_primary(state.pump_primary_status, 50),  # PWM placeholder
+            'pump_secondary': lambda: self.update_pump_secondary(state.pump_secondary_status, 50),
+            'pump_tertiary': lambda: self.update_pump_tertiary(state.pump_tertiary_status, 50),
+            'safety_rod': lambda: self.update_safety_rod(state.safety_rod),
+            'shim_rod': lambda: self.update_shim_rod(state.shim_rod),
+            'regulating_rod': lambda: self.update_regulating_rod(state.regulating_rod),
+            'thermal_power': lambda: self.update_thermal_power(state.thermal_kw),
+            'system_status': lambda: self.update_system_status(
+                auto_sim_running=state.auto_sim_running,
+                auto_sim_phase=state.auto_sim_phase,
+                pressure=state.pressure,
+                pump_primary=state.pump_primary_status,
+                pump_secondary=state.pump_secondary_status,
+                pump_tertiary=state.pump_tertiary_status,
+                interlock=state.interlock_satisfied,
+                thermal_kw=state.thermal_kw,
+                turbine_speed=state.turbine_speed,
+                emergency_active=state.emergency_active)
+        }
+
+        # Earliest-deadline-first over the displays that are due
+        now = time.time()
+        due = [name for name in renderers if self.display_deadlines[name] <= now]
+        due.sort(key=lambda name: self.display_deadlines[name])
+
+        for name in due:
+            renderers[name]()  # Renders + queues only if content changed
+            self.display_deadlines[name] = now + self._display_period(name)
+
         # ============================================
-        # MUX #2 (0x71) - Channels 1-2
+        # FLUSH - one channel-ordered I2C pass (budgeted)
         # ============================================
-        # Auto-delay handled by TCA9548AManager when switching between MUX
-        
-        self.update_thermal_power(state.thermal_kw)
-        
-        self.update_system_status(
-            auto_sim_running=state.auto_sim_running,
-            auto_sim_phase=state.auto_sim_phase,
-            pressure=state.pressure,
-            pump_primary=state.pump_primary_status,
-            pump_secondary=state.pump_secondary_status,
-            pump_tertiary=state.pump_tertiary_status,
-            interlock=state.interlock_satisfied,
-            thermal_kw=state.thermal_kw,
-            turbine_speed=state.turbine_speed,
-            emergency_active=state.emergency_active
-        )
-    
+        self._flush_pending()
+
     def show_startup_screen(self):
         """Show startup screen on all 9 displays (128x32 layout)"""
         screens_mux1 = [
@@ -0,0 +1,377 @@
+#!/usr/bin/env python3
+"""
+Binary Protocol Benchmark Harness
+
+Quantifies protocol changes instead of guessing: drives N thousand
+transactions through the real UARTDevice.send_receive_binary() path
+(same CRC8, frame parser, ACK/NACK and retry code as production) and
+reports round-trip latency percentiles, throughput, retry counts and
+timeout rates.
+
+Two transport modes:
+- loopback: in-process fake ESP-BC that validates frames and answers
+  with ACK + 23-byte telemetry (or NACK on bad CRC), exactly like the
+  .ino state machine. No hardware needed, runs anywhere.
+- esp: real serial port with an ESP attached - measures the actual link.
+
+Fault injection (loopback mode) corrupts CRC bytes, drops response
+bytes and injects garbage between frames at configurable rates, to
+validate the NACK/retry/resync path under load.
+
+Usage:
+    python3 raspi_protocol_benchmark.py --count 2000
+    python3 raspi_protocol_benchmark.py --count 2000 --fault-crc 0.05 --fault-drop 0.02 --fault-garbage 0.05
+    python3 raspi_protocol_benchmark.py --mode esp --port /dev/ttyAMA0 --count 1000
+"""
+
+import argparse
+import logging
+import random
+import struct
+import sys
+import time
+
+from raspi_hotlog import hotlog
+from raspi_uart_master import (
+    STX, ETX, ACK, NACK,
+    UARTDevice, crc8_maxim,
+    encode_esp_bc_update, decode_binary_response,
+)
+
+logger = logging.getLogger(__name__)
+
+# ESP-BC update response: STX + ACK + LEN=23 + payload + CRC + ETX
+ESP_BC_RESPONSE_LEN = 28
+
+
+# ============================================
+# Loopback Fake ESP
+# ============================================
+
+class FaultInjector:
+    """
+    Fault injection for the loopback transport
+
+    Each rate is a per-transaction probability:
+    - corrupt_crc: flip a bit in the request CRC (ESP must NACK)
+    - drop_byte: remove one byte from the response (parser must time out)
+    - garbage: prepend random bytes before the response (parser must resync)
+    """
+
+    def __init__(self, corrupt_crc=0.0, drop_byte=0.0, garbage=0.0, seed=42):
+        self.corrupt_crc = corrupt_crc
+        self.drop_byte = drop_byte
+        self.garbage = garbage
+        self.rng = random.Random(seed)
+
+        # Counters for the report
+        self.crc_corruptions = 0
+        self.bytes_dropped = 0
+        self.garbage_injections = 0
+
+    def mangle_request(self, frame: bytes) -> bytes:
+        """Corrupt the request in flight (before the fake ESP parses it)"""
+        if self.corrupt_crc and self.rng.random() < self.corrupt_crc:
+            self.crc_corruptions += 1
+            mangled = bytearray(frame)
+            mangled[-2] ^= 0xFF  # CRC byte
+            return bytes(mangled)
+        return frame
+
+    def mangle_response(self, frame: bytes) -> bytes:
+        """Corrupt the response in flight (before the master parses it)"""
+        if self.drop_byte and self.rng.random() < self.drop_byte:
+            self.bytes_dropped += 1
+            drop_at = self.rng.randrange(len(frame))
+            frame = frame[:drop_at] + frame[drop_at + 1:]
+        if self.garbage and self.rng.random() < self.garbage:
+            self.garbage_injections += 1
+            junk = bytes(self.rng.randrange(256) for _ in range(self.rng.randrange(1, 8)))
+            frame = junk + frame
+        return frame
+
+
+class LoopbackESPSerial:
+    """
+    In-process stand-in for an ESP-BC behind a serial port
+
+    Implements the subset of the pyserial interface that UARTDevice
+    touches (write/read/in_waiting/flush/reset buffers/timeout) and
+    answers CMD frames the way the .ino sketch does: validate CRC,
+    reply ACK + telemetry, or NACK when the frame is bad.
+    """
+
+    def __init__(self, fault_injector=None, response_delay=0.0):
+        self.is_open = True
+        self.timeout = 1.0
+        self.fault = fault_injector or FaultInjector()
+        self.response_delay = response_delay  # Simulated ESP processing time
+        self._rx_buffer = bytearray()  # Bytes waiting for the master to read
+        self.nacks_sent = 0
+
+    # --- Master-facing pyserial surface ---
+
+    @property
+    def in_waiting(self):
+        return len(self._rx_buffer)
+
+    def write(self, data: bytes) -> int:
+        self._handle_frame(self.fault.mangle_request(bytes(data)))
+        return len(data)
+
+    def read(self, size=1) -> bytes:
+        if not self._rx_buffer:
+            # Emulate the blocking read timeout without burning CPU
+            time.sleep(min(self.timeout, 0.001))
+            if not self._rx_buffer:
+                return b''
+        chunk = bytes(self._rx_buffer[:size])
+        del self._rx_buffer[:size]
+        return chunk
+
+    def flush(self):
+        pass
+
+    def reset_input_buffer(self):
+        self._rx_buffer.clear()
+
+    def reset_output_buffer(self):
+        pass
+
+    def close(self):
+        self.is_open = False
+
+    # --- Fake ESP firmware ---
+
+    def _handle_frame(self, frame: bytes):
+        """Validate the request and queue the response (ESP side)"""
+        if self.response_delay:
+            time.sleep(self.response_delay)
+
+        # Frame + CRC validation, mirroring the .ino receive path
+        valid = (
+            len(frame) >= 5
+            and frame[0] == STX
+            and frame[-1] == ETX
+            and len(frame) == 5 + frame[2]
+            and frame[-2] == crc8_maxim(frame[1:-2])
+        )
+
+        if valid:
+            response = self._build_telemetry_response(frame)
+        else:
+            # Bad CRC/framing: NACK so the master retries
+            self.nacks_sent += 1
+            crc = crc8_maxim(bytes([NACK, 0]))
+            response = bytes([STX, NACK, 0, crc, ETX])
+
+        self._rx_buffer += self.fault.mangle_response(response)
+
+    @staticmethod
+    def _build_telemetry_response(request: bytes) -> bytes:
+        """ACK + 23-byte ESP-BC telemetry payload (rods echo the request)"""
+        rod1, rod2, rod3 = request[3], request[4], request[5]
+        payload = bytes([rod1, rod2, rod3])
+        payload += struct.pack('<f', 1250.0)          # thermal_kw
+        payload += struct.pack('<H', int(75.5 * 100)) # power_level
+        payload += bytes([2])                         # state
+        payload += struct.pack('<H', int(30.0 * 100)) # turbine_speed
+        payload += struct.pack('<H', int(80.0 * 100)) # pump speeds
+        payload += struct.pack('<H', int(60.0 * 100))
+        payload += struct.pack('<H', int(40.0 * 100))
+        payload += bytes([1, 1, 0, 0])                # humid status
+        payload += bytes([7])                         # cmd_generation
+        crc = crc8_maxim(bytes([ACK, len(payload)]) + payload)
+        return bytes([STX, ACK, len(payload)]) + payload + bytes([crc, ETX])
+
+
+# ============================================
+# Benchmark Runner
+# ============================================
+
+class BenchmarkStats:
+    """Collects per-transaction results and renders the report"""
+
+    def __init__(self):
+        self.latencies = []   # Seconds, successful transactions only
+        self.successes = 0
+        self.failures = 0     # None after all retries (timeout path)
+        self.tx_writes = 0    # Raw writes - excess over transactions = retries
+        self.start_time = 0.0
+        self.end_time = 0.0
+
+    def percentile(self, p):
+        """Nearest-rank percentile over successful latencies"""
+        if not self.latencies:
+            return 0.0
+        ordered = sorted(self.latencies)
+        index = min(len(ordered) - 1, int(round(p / 100.0 * len(ordered) + 0.5)) - 1)
+        return ordered[max(0, index)]
+
+    def print_histogram(self, buckets=12):
+        """ASCII latency histogram (successful transactions)"""
+        if not self.latencies:
+            print("  (no successful transactions)")
+            return
+        lo = min(self.latencies)
+        hi = max(self.latencies)
+        span = (hi - lo) or 1e-9
+        counts = [0] * buckets
+        for latency in self.latencies:
+            counts[min(buckets - 1, int((latency - lo) / span * buckets))] += 1
+        peak = max(counts)
+        for i, count in enumerate(counts):
+            bucket_lo = (lo + span * i / buckets) * 1000
+            bucket_hi = (lo + span * (i + 1) / buckets) * 1000
+            bar = '#' * int(count / peak * 40) if peak else ''
+            print(f"  {bucket_lo:7.2f}-{bucket_hi:7.2f} ms | {count:6d} | {bar}")
+
+    def print_report(self, fault=None, nacks=0):
+        total = self.successes + self.failures
+        elapsed = self.end_time - self.start_time
+        retries = self.tx_writes - total
+
+        print()
+        print("=" * 60)
+        print("  Benchmark Report")
+        print("=" * 60)
+        print(f"Transactions:      {total}")
+        print(f"  Successful:      {self.successes}")
+        if total:
+            print(f"  Failed:          {self.failures} ({self.failures / total * 100:.2f}% timeout rate)")
+        print(f"Retries:           {retries}")
+        print(f"Elapsed:           {elapsed:.2f}s")
+        if elapsed > 0:
+            print(f"Throughput:        {total / elapsed:.1f} txn/s")
+        print()
+        print("Round-trip latency (successful):")
+        print(f"  p50:             {self.percentile(50) * 1000:.3f} ms")
+        print(f"  p95:             {self.percentile(95) * 1000:.3f} ms")
+        print(f"  p99:             {self.percentile(99) * 1000:.3f} ms")
+        if self.latencies:
+            print(f"  min/max:         {min(self.latencies) * 1000:.3f} / {max(self.latencies) * 1000:.3f} ms")
+        print()
+        print("Histogram:")
+        self.print_histogram()
+
+        if fault is not None:
+            print()
+            print("Fault injection:")
+            print(f"  CRC corruptions:     {fault.crc_corruptions} (NACKs from ESP: {nacks})")
+            print(f"  Bytes dropped:       {fault.bytes_dropped}")
+            print(f"  Garbage injections:  {fault.garbage_injections}")
+        print("=" * 60)
+
+
+def run_benchmark(device: UARTDevice, count: int, timeout: float) -> BenchmarkStats:
+    """
+    Drive `count` ESP-BC update transactions through send_receive_binary
+
+    Rod values cycle so frames differ transaction to transaction; retries
+    are counted by wrapping the raw serial write.
+    """
+    stats = BenchmarkStats()
+
+    # Count raw writes to derive the retry count (works for both modes)
+    original_write = device.serial.write
+
+    def counting_write(data):
+        stats.tx_writes += 1
+        return original_write(data)
+
+    device.serial.write = counting_write
+
+    print(f"Running {count} transactions (timeout {timeout}s)...")
+    stats.start_time = time.time()
+
+    for i in range(count):
+        command = encode_esp_bc_update(
+            rods=[i % 101, (i * 2) % 101, (i * 3) % 101],
+            pumps=[i % 4, (i + 1) % 4, (i + 2) % 4],
+            humid=[i % 2, (i + 1) % 2, i % 2, (i + 1) % 2]
+        )
+        started = time.perf_counter()
+        result = device.send_receive_binary(command, ESP_BC_RESPONSE_LEN, timeout=timeout)
+        elapsed = time.perf_counter() - started
+
+        if result is not None:
+            stats.successes += 1
+            stats.latencies.append(elapsed)
+        else:
+            stats.failures += 1
+
+        if (i + 1) % 500 == 0:
+            print(f"  ... {i + 1}/{count}")
+
+    stats.end_time = time.time()
+    device.serial.write = original_write
+    return stats
+
+
+# ============================================
+# Entry Point
+# ============================================
+
+def main():
+    parser = argparse.ArgumentParser(description="Binary protocol benchmark harness")
+    parser.add_argument('--mode', choices=['loopback', 'esp'], default='loopback',
+                        help="loopback = in-process fake ESP, esp = real port")
+    parser.add_argument('--port', default='/dev/ttyAMA0',
+                        help="Serial port for --mode esp")
+    parser.add_argument('--baud', type=int, default=115200,
+                        help="Baud rate for --mode esp")
+    parser.add_argument('--count', type=int, default=1000,
+                        help="Number of transactions")
+    parser.add_argument('--timeout', type=float, default=0.1,
+                        help="Per-transaction response timeout (s)")
+    parser.add_argument('--fault-crc', type=float, default=0.0,
+                        help="P(corrupt request CRC) per txn (loopback only)")
+    parser.add_argument('--fault-drop', type=float, default=0.0,
+                        help="P(drop a response byte) per txn (loopback only)")
+    parser.add_argument('--fault-garbage', type=float, default=0.0,
+                        help="P(inject garbage before response) per txn (loopback only)")
+    parser.add_argument('--response-delay', type=float, default=0.0,
+                        help="Simulated ESP processing delay in s (loopback only)")
+    parser.add_argument('--seed', type=int, default=42,
+                        help="Fault injection RNG seed (reproducible runs)")
+    parser.add_argument('--verbose', action='store_true',
+                        help="Keep per-frame TX/RX logging enabled")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO if args.verbose else logging.ERROR,
+                        format='%(levelname)s: %(message)s')
+    if not args.verbose:
+        # Per-frame capture would skew the numbers we're measuring
+        hotlog.set_enabled(False)
+
+    print("=" * 60)
+    print("  Binary Protocol Benchmark")
+    print("=" * 60)
+    print(f"Mode: {args.mode}")
+
+    fault = None
+    if args.mode == 'loopback':
+        fault = FaultInjector(corrupt_crc=args.fault_crc,
+                              drop_byte=args.fault_drop,
+                              garbage=args.fault_garbage,
+                              seed=args.seed)
+        device = UARTDevice('loopback', baudrate=args.baud)
+        device.serial = LoopbackESPSerial(fault, response_delay=args.response_delay)
+    else:
+        device = UARTDevice(args.port, baudrate=args.baud, timeout=args.timeout)
+        if not device.connect():
+            print(f"❌ Could not open {args.port}")
+            return 1
+
+    try:
+        stats = run_benchmark(device, args.count, args.timeout)
+    finally:
+        device.serial.close()
+
+    nacks = device.serial.nacks_sent if args.mode == 'loopback' else 0
+    stats.print_report(fault=fault, nacks=nacks)
+    return 0 if stats.successes else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
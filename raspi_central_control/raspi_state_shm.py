@@ -0,0 +1,288 @@
+"""
+Shared-Memory State Export untuk PLTN Simulator
+Binary state channel antara panel controller dan video display app
+
+Replaces the 10Hz JSON temp-file + rename export: state is packed into a
+fixed-layout struct inside an mmap'd file under /dev/shm (tmpfs - zero
+SD card writes). A seqlock-style sequence counter detects torn reads:
+
+    [magic 4B][version u32][seq u32][payload 61B]
+
+Writer protocol:
+    seq += 1 (odd = write in progress)
+    memcpy payload
+    seq += 1 (even = stable)
+
+Reader protocol:
+    read seq1 - if odd, writer is mid-update, retry
+    read payload
+    read seq2 - accept only if seq1 == seq2
+
+Export cost is a single memcpy, so the writer can run at the full 20Hz
+control rate. Reader returns a dict with the SAME keys as the legacy
+JSON export - drop-in for existing consumers.
+
+Usage (writer side):
+    writer = StateShmWriter()
+    writer.write(state_dict)
+
+Usage (reader side):
+    reader = StateShmReader()
+    state = reader.read()  # dict or None
+"""
+
+import mmap
+import struct
+import time
+from pathlib import Path
+from typing import Optional, Dict
+
+# ============================================
+# Layout Constants
+# ============================================
+
+# Default path - /dev/shm is tmpfs on Linux (RAM-backed, no SD wear)
+STATE_SHM_PATH = "/dev/shm/pltn_state.bin"
+
+SHM_MAGIC = b'PLTN'
+SHM_VERSION = 1
+
+# Header: magic, version, sequence counter
+HEADER_FORMAT = '<4sII'
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)  # 12 bytes
+SEQ_OFFSET = 8  # offset of the u32 sequence counter within the header
+
+# Payload: fixed-layout packed struct (the 15 exported fields)
+#   timestamp      double
+#   mode           u8   (0=manual, 1=auto)
+#   auto_running   u8
+#   emergency      u8
+#   auto_phase     32s  (utf-8, zero-padded)
+#   pressure       float
+#   safety_rod     u8   (0-100%)
+#   shim_rod       u8
+#   regulating_rod u8
+#   pump_primary   u8   (0=OFF, 1=STARTING, 2=ON, 3=SHUTTING_DOWN)
+#   pump_secondary u8
+#   pump_tertiary  u8
+#   thermal_kw     float
+#   turbine_speed  float
+PAYLOAD_FORMAT = '<dBBB32sfBBBBBBff'
+PAYLOAD_SIZE = struct.calcsize(PAYLOAD_FORMAT)
+
+SHM_TOTAL_SIZE = HEADER_SIZE + PAYLOAD_SIZE
+
+# Max read attempts before giving up on a torn read (writer is ~microseconds)
+MAX_READ_RETRIES = 3
+
+
+# ============================================
+# Writer (panel controller side)
+# ============================================
+
+class StateShmWriter:
+    """
+    Seqlock writer - owns the mmap'd file, called from state_export_thread
+
+    Raises OSError/ValueError from __init__ if the backing file can't be
+    created (e.g. non-Linux platform without /dev/shm) - caller should
+    fall back to the legacy JSON export.
+    """
+
+    def __init__(self, path: str = STATE_SHM_PATH):
+        self.path = Path(path)
+        self.seq = 0
+
+        # Create/truncate backing file at fixed size, then map it
+        with open(self.path, 'wb') as f:
+            f.write(b'\x00' * SHM_TOTAL_SIZE)
+
+        self._file = open(self.path, 'r+b')
+        self._mmap = mmap.mmap(self._file.fileno(), SHM_TOTAL_SIZE)
+
+        # Write header once (seq starts at 0 = stable/empty)
+        self._mmap[:HEADER_SIZE] = struct.pack(HEADER_FORMAT, SHM_MAGIC, SHM_VERSION, 0)
+
+    def write(self, state: Dict):
+        """
+        Publish one state snapshot (single memcpy under seqlock)
+
+        Args:
+            state: dict with the legacy JSON export keys
+        """
+        payload = struct.pack(
+            PAYLOAD_FORMAT,
+            float(state.get("timestamp", time.time())),
+            1 if state.get("mode", "manual") == "auto" else 0,
+            1 if state.get("auto_running", False) else 0,
+            1 if state.get("emergency", False) else 0,
+            str(state.get("auto_phase", ""))[:32].encode('utf-8', 'replace')[:32],
+            float(state.get("pressure", 0.0)),
+            int(state.get("safety_rod", 0)) & 0xFF,
+            int(state.get("shim_rod", 0)) & 0xFF,
+            int(state.get("regulating_rod", 0)) & 0xFF,
+            int(state.get("pump_primary", 0)) & 0xFF,
+            int(state.get("pump_secondary", 0)) & 0xFF,
+            int(state.get("pump_tertiary", 0)) & 0xFF,
+            float(state.get("thermal_kw", 0.0)),
+            float(state.get("turbine_speed", 0.0))
+        )
+
+        # Seqlock: odd = write in progress, even = stable
+        self.seq += 1
+        self._mmap[SEQ_OFFSET:SEQ_OFFSET + 4] = struct.pack('<I', self.seq)
+        self._mmap[HEADER_SIZE:HEADER_SIZE + PAYLOAD_SIZE] = payload
+        self.seq += 1
+        self._mmap[SEQ_OFFSET:SEQ_OFFSET + 4] = struct.pack('<I', self.seq)
+
+    def close(self):
+        """Release the mapping (file stays for late readers)"""
+        try:
+            self._mmap.close()
+            self._file.close()
+        except Exception:
+            pass
+
+
+# ============================================
+# Reader (video display side)
+# ============================================
+
+class StateShmReader:
+    """
+    Seqlock reader - maps the file read-only, never blocks the writer
+
+    read() returns a dict with the same keys as the legacy JSON export,
+    or None if the channel doesn't exist yet / no snapshot published.
+    """
+
+    def __init__(self, path: str = STATE_SHM_PATH):
+        self.path = Path(path)
+        self._file = None
+        self._mmap = None
+
+    def _ensure_mapped(self) -> bool:
+        """Lazy-open the mapping (writer may start after the reader)"""
+        if self._mmap is not None:
+            return True
+        try:
+            if not self.path.exists():
+                return False
+            f = open(self.path, 'rb')
+            m = mmap.mmap(f.fileno(), SHM_TOTAL_SIZE, access=mmap.ACCESS_READ)
+            magic, version, _ = struct.unpack_from(HEADER_FORMAT, m, 0)
+            if magic != SHM_MAGIC or version != SHM_VERSION:
+                m.close()
+                f.close()
+                return False
+            self._file = f
+            self._mmap = m
+            return True
+        except (OSError, ValueError):
+            return False
+
+    def read(self) -> Optional[Dict]:
+        """
+        Read the latest consistent snapshot
+
+        Returns:
+            State dict (legacy JSON export keys) or None
+        """
+        if not self._ensure_mapped():
+            return None
+
+        for _ in range(MAX_READ_RETRIES):
+            (seq1,) = struct.unpack_from('<I', self._mmap, SEQ_OFFSET)
+            if seq1 == 0:
+                return None  # Nothing published yet
+            if seq1 & 1:
+                continue  # Write in progress - retry
+
+            fields = struct.unpack_from(PAYLOAD_FORMAT, self._mmap, HEADER_SIZE)
+
+            (seq2,) = struct.unpack_from('<I', self._mmap, SEQ_OFFSET)
+            if seq1 != seq2:
+                continue  # Torn read - retry
+
+            (timestamp, mode, auto_running, emergency, auto_phase,
+             pressure, safety_rod, shim_rod, regulating_rod,
+             pump_primary, pump_secondary, pump_tertiary,
+             thermal_kw, turbine_speed) = fields
+
+            return {
+                "timestamp": timestamp,
+                "mode": "auto" if mode else "manual",
+                "auto_running": bool(auto_running),
+                "auto_phase": auto_phase.rstrip(b'\x00').decode('utf-8', 'replace'),
+                "pressure": pressure,
+                "safety_rod": safety_rod,
+                "shim_rod": shim_rod,
+                "regulating_rod": regulating_rod,
+                "pump_primary": pump_primary,
+                "pump_secondary": pump_secondary,
+                "pump_tertiary": pump_tertiary,
+                "thermal_kw": thermal_kw,
+                "turbine_speed": turbine_speed,
+                "emergency": bool(emergency)
+            }
+
+        return None  # Writer too busy (shouldn't happen - write is ~µs)
+
+    def close(self):
+        """Release the mapping"""
+        try:
+            if self._mmap:
+                self._mmap.close()
+            if self._file:
+                self._file.close()
+        except Exception:
+            pass
+        self._mmap = None
+        self._file = None
+
+
+# ============================================
+# Self-test
+# ============================================
+
+if __name__ == "__main__":
+    import tempfile
+    import os
+
+    print("Testing shared-memory state channel...")
+    test_path = os.path.join(tempfile.gettempdir(), "pltn_state_test.bin")
+
+    writer = StateShmWriter(test_path)
+    reader = StateShmReader(test_path)
+
+    assert reader.read() is None, "Expected None before first write"
+
+    writer.write({
+        "timestamp": 123.5,
+        "mode": "auto",
+        "auto_running": True,
+        "auto_phase": "Raising Pressure",
+        "pressure": 140.0,
+        "safety_rod": 100,
+        "shim_rod": 75,
+        "regulating_rod": 50,
+        "pump_primary": 2,
+        "pump_secondary": 1,
+        "pump_tertiary": 0,
+        "thermal_kw": 850.5,
+        "turbine_speed": 72.0,
+        "emergency": False
+    })
+
+    state = reader.read()
+    assert state is not None
+    assert state["mode"] == "auto"
+    assert state["auto_phase"] == "Raising Pressure"
+    assert state["safety_rod"] == 100
+    assert abs(state["thermal_kw"] - 850.5) < 0.01
+    print(f"✅ Round-trip OK: {state}")
+
+    writer.close()
+    reader.close()
+    os.unlink(test_path)
+    print("✅ All tests passed")
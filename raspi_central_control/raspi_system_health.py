@@ -15,6 +15,7 @@ logger = logging.getLogger(__name__)
 class HealthStatus(Enum):
     """Health status levels"""
     OK = "OK"
+    INFO = "INFO"
     WARNING = "WARNING"
     ERROR = "ERROR"
     CRITICAL = "CRITICAL"
@@ -29,16 +30,34 @@ class ComponentHealth:
     message: str = ""
     details: Dict = field(default_factory=dict)
     last_check: float = 0.0
-    
+
     def is_healthy(self) -> bool:
         """Check if component is in healthy state"""
-        return self.status in [HealthStatus.OK, HealthStatus.WARNING]
-    
+        return self.status in [HealthStatus.OK, HealthStatus.INFO, HealthStatus.WARNING]
+
     def is_critical(self) -> bool:
         """Check if component is in critical state"""
         return self.status in [HealthStatus.ERROR, HealthStatus.CRITICAL]
 
 
+@dataclass
+class HealthTask:
+    """
+    One schedulable component check for incremental monitoring
+
+    Each check runs on its own interval with a soft time budget: the
+    check can't be preempted mid-I/O, but a check that overruns its
+    budget gets its next run pushed out (doubled interval for that
+    round) so a slow bus never eats consecutive ticks.
+    """
+    key: str                 # components dict key ("mux", "esp_bc", ...)
+    func: object             # bound _check_* method
+    interval: float          # seconds between runs
+    budget: float            # soft budget per run (seconds)
+    next_due: float = 0.0
+    overruns: int = 0
+
+
 class SystemHealthMonitor:
     """
     Comprehensive system health monitoring
@@ -57,7 +76,22 @@ class SystemHealthMonitor:
         self.components: Dict[str, ComponentHealth] = {}
         self.last_full_check = 0.0
         self.system_ready = False
-        
+
+        # Incremental schedule: intervals reflect how likely a component
+        # is to degrade at runtime and how much a check costs on the
+        # shared buses. ESP checks are real UART transactions, the mux
+        # check is an I2C scan - they get the tightest budgets watched.
+        self._tasks: List[HealthTask] = [
+            HealthTask("mux", self._check_multiplexers, interval=30.0, budget=0.25),
+            HealthTask("uart_master", self._check_uart_master, interval=15.0, budget=0.05),
+            HealthTask("esp_bc", self._check_esp_bc, interval=5.0, budget=0.5),
+            HealthTask("esp_e", self._check_esp_e, interval=10.0, budget=0.5),
+            HealthTask("oled", self._check_oled_displays, interval=15.0, budget=0.05),
+            HealthTask("buttons", self._check_gpio_buttons, interval=60.0, budget=0.05),
+            HealthTask("humidifier", self._check_humidifier, interval=60.0, budget=0.05),
+            HealthTask("buzzer", self._check_buzzer, interval=60.0, budget=0.05),
+        ]
+
     def check_all(self, panel_controller) -> bool:
         """
         Perform full system health check
@@ -107,10 +141,82 @@ class SystemHealthMonitor:
             self.system_ready = False
         
         logger.info("="*70)
-        
+
         self.last_full_check = time.time()
+
+        # Stagger the incremental schedule off this sweep so the
+        # periodic checks don't all come due on the same tick
+        for i, task in enumerate(self._tasks):
+            task.next_due = self.last_full_check + task.interval + i
+
         return self.system_ready
-    
+
+    def tick(self, panel_controller, quiet: bool = True) -> Optional[str]:
+        """
+        Run AT MOST ONE due component check (incremental monitoring)
+
+        Replaces periodic check_all sweeps: the full 8-check sweep held
+        the shared I2C buses and UART ports for hundreds of milliseconds
+        while the live control path contended for them. Called from
+        health_monitoring_thread once per second, this runs a single
+        small check at a time and publishes into the cached components
+        table that get_summary reads instantly.
+
+        Args:
+            panel_controller: Reference to PLTNPanelController
+            quiet: Suppress the per-check INFO chatter (degradations
+                   still log at WARNING and above)
+
+        Returns:
+            Key of the check that ran, or None if nothing was due
+        """
+        now = time.time()
+        due = [t for t in self._tasks if now >= t.next_due]
+        if not due:
+            return None
+
+        # Most overdue first - a cheap check can't starve an expensive one
+        task = min(due, key=lambda t: t.next_due)
+
+        prev_level = logger.level
+        if quiet:
+            logger.setLevel(logging.WARNING)
+        start = time.time()
+        try:
+            task.func(panel_controller)
+        except Exception as e:
+            logger.error(f"Health check '{task.key}' crashed: {e}")
+        finally:
+            if quiet:
+                logger.setLevel(prev_level)
+
+        elapsed = time.time() - start
+        component = self.components.get(task.key)
+        if component:
+            component.last_check = now
+
+        if elapsed > task.budget:
+            # Can't preempt a blocking bus call - back off instead, so a
+            # slow component doesn't eat consecutive bus-idle gaps
+            task.overruns += 1
+            task.next_due = now + task.interval * 2
+            logger.warning(f"⚠️  Health check '{task.key}' took {elapsed * 1000:.0f}ms "
+                           f"(budget {task.budget * 1000:.0f}ms, overrun #{task.overruns}) "
+                           f"- backing off to {task.interval * 2:.0f}s")
+        else:
+            task.next_due = now + task.interval
+
+        # Keep system_ready current from the cached table (a component
+        # going critical at runtime must surface without a full sweep)
+        was_ready = self.system_ready
+        self.system_ready = not any(c.is_critical() for c in self.components.values())
+        if was_ready and not self.system_ready:
+            logger.error(f"❌ SYSTEM DEGRADED - '{task.key}' reported a critical issue")
+        elif not was_ready and self.system_ready:
+            logger.info("✅ SYSTEM RECOVERED - no critical issues remaining")
+
+        return task.key
+
     def _check_multiplexers(self, panel):
         """Check TCA9548A multiplexers"""
         logger.info("\n[1/8] Checking I2C Multiplexers...")
@@ -214,6 +320,7 @@ class SystemHealthMonitor:
                 health = panel.uart_master.get_health_status()
                 esp_bc_health = health.get('esp_bc', {})
                 error_count = esp_bc_health.get('error_count', 999)
+                self._log_esp_stats(esp_bc_health)
                 
                 if error_count == 0:
                     self.components["esp_bc"] = ComponentHealth(
@@ -283,6 +390,7 @@ class SystemHealthMonitor:
                 health = panel.uart_master.get_health_status()
                 esp_e_health = health.get('esp_e', {})
                 error_count = esp_e_health.get('error_count', 999)
+                self._log_esp_stats(esp_e_health)
                 
                 if error_count == 0:
                     self.components["esp_e"] = ComponentHealth(
@@ -316,6 +424,21 @@ class SystemHealthMonitor:
             )
             logger.warning(f"  ⚠️  WARNING: Exception - {e} (non-critical)")
     
+    @staticmethod
+    def _log_esp_stats(esp_health: Dict):
+        """Log the on-ESP performance counters (CMD_STATS) if present"""
+        stats = esp_health.get('stats')
+        if not stats:
+            return
+        logger.info(f"     Loop period: {stats['loop_period_mean_us'] / 1000:.1f}ms mean "
+                    f"({stats['loop_period_min_us'] / 1000:.1f}-"
+                    f"{stats['loop_period_max_us'] / 1000:.1f}ms)")
+        logger.info(f"     Frames: {stats['frames_received']} received, "
+                    f"{stats['crc_failures']} CRC failures, "
+                    f"{stats['nacks_sent']} NACKs, "
+                    f"{stats['buffer_overflows']} buffer overflows, "
+                    f"{stats['actuator_updates']} actuator updates")
+
     def _check_oled_displays(self, panel):
         """Check OLED displays"""
         logger.info("\n[5/8] Checking OLED Displays...")
@@ -501,7 +624,8 @@ class SystemHealthMonitor:
                 name: {
                     'status': comp.status.value,
                     'message': comp.message,
-                    'details': comp.details
+                    'details': comp.details,
+                    'last_check': comp.last_check
                 }
                 for name, comp in self.components.items()
             }
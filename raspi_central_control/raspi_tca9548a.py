@@ -3,14 +3,64 @@ TCA9548A I2C Multiplexer Driver
 Manages dual TCA9548A for OLED displays and ESP slaves
 """
 
+import glob
 import smbus2
 import logging
+import struct
 import time
 from typing import Optional
 
 logger = logging.getLogger(__name__)
 
 
+def get_i2c_bus_speed() -> Optional[int]:
+    """
+    Read the actual I2C bus clock from the device tree
+
+    The Pi's I2C speed is fixed at boot by the firmware (dtparam
+    i2c_arm_baudrate) - it cannot be changed at runtime, so all we can
+    do here is report what the bus is really running at.
+
+    Returns:
+        Bus clock in Hz, or None if it can't be determined
+    """
+    try:
+        # clock-frequency is a big-endian u32 in the DT node
+        for node in glob.glob('/proc/device-tree/soc/i2c*/clock-frequency'):
+            with open(node, 'rb') as f:
+                raw = f.read(4)
+            if len(raw) == 4:
+                return struct.unpack('>I', raw)[0]
+    except OSError:
+        pass
+    return None
+
+
+def check_bus_speed(expected_hz: int) -> bool:
+    """
+    Verify the display bus runs at the configured speed profile
+
+    Args:
+        expected_hz: Desired bus clock (config.I2C_BUS_SPEED_HZ)
+
+    Returns:
+        True if the bus is at (or above) the expected speed
+    """
+    actual = get_i2c_bus_speed()
+    if actual is None:
+        logger.warning("⚠️  Could not determine I2C bus speed (no device-tree node)")
+        return False
+
+    if actual >= expected_hz:
+        logger.info(f"✓ I2C bus running at {actual // 1000}kHz (fast mode profile)")
+        return True
+
+    logger.warning(f"⚠️  I2C bus at {actual // 1000}kHz, profile wants {expected_hz // 1000}kHz")
+    logger.warning("   Add to /boot/config.txt:  dtparam=i2c_arm_baudrate=%d" % expected_hz)
+    logger.warning("   OLED bandwidth will be limited until reboot with fast mode")
+    return False
+
+
 class TCA9548A:
     """
     TCA9548A I2C Multiplexer Driver
@@ -160,16 +210,18 @@ class DualMultiplexerManager:
       - Channel 1-2: OLED #8-9 (all at 0x3C)
     """
     
-    def __init__(self, display_bus: int, esp_bus: int, 
-                 display_addr: int = 0x70, esp_addr: int = 0x71):
+    def __init__(self, display_bus: int, esp_bus: int,
+                 display_addr: int = 0x70, esp_addr: int = 0x71,
+                 expected_speed_hz: Optional[int] = None):
         """
         Initialize dual multiplexer manager
-        
+
         Args:
             display_bus: I2C bus for multiplexer #1 (0x70)
             esp_bus: I2C bus for multiplexer #2 (0x71)
             display_addr: Address of TCA9548A #1 (default 0x70)
             esp_addr: Address of TCA9548A #2 (default 0x71)
+            expected_speed_hz: Bus speed profile to verify (None = skip check)
         """
         self.mux1 = TCA9548A(display_bus, display_addr)  # TCA9548A #1 (0x70)
         self.mux2 = TCA9548A(esp_bus, esp_addr)          # TCA9548A #2 (0x71)
@@ -179,6 +231,11 @@ class DualMultiplexerManager:
         logger.info(f"Dual multiplexer manager initialized:")
         logger.info(f"  MUX #1 (ESP-BC + OLED 1-7): 0x{display_addr:02X}")
         logger.info(f"  MUX #2 (ESP-E + OLED 8-9): 0x{esp_addr:02X}")
+
+        # Verify the bus runs at the configured speed profile (400kHz
+        # fast mode) - informational only, speed is fixed at boot
+        if expected_speed_hz:
+            check_bus_speed(expected_speed_hz)
     
     def select_mux1_channel(self, channel: int) -> bool:
         """
@@ -24,6 +24,8 @@ from typing import Optional, Dict, Tuple
 from dataclasses import dataclass
 import threading
 
+from raspi_hotlog import hotlog
+
 logger = logging.getLogger(__name__)
 
 
@@ -38,6 +40,18 @@ NACK = 0x15  # Negative Acknowledge
 # Command types
 CMD_PING = 0x50  # 'P'
 CMD_UPDATE = 0x55  # 'U'
+CMD_STREAM = 0x53  # 'S' - Stream control (unsolicited telemetry push)
+CMD_KEEPALIVE = 0x4B  # 'K' - No-change poll (delta protocol, ESP-BC only)
+CMD_SET_BAUD = 0x42  # 'B' - Switch link baud rate
+CMD_STATS = 0x54  # 'T' - Read on-ESP performance counters
+
+# High-baud negotiation: ping at 115200, switch both ends with SET_BAUD,
+# fall back automatically if the post-switch ping fails. The ESP reverts
+# on its own after 3s without a valid frame at the new rate.
+NEGOTIATE_HIGH_BAUD = True
+HIGH_BAUD = 921600
+DEFAULT_BAUD = 115200
+BAUD_REVERT_WAIT = 3.5  # ESP's confirm window (3s) plus margin
 
 # Protocol configuration
 USE_BINARY_PROTOCOL = True  # Set to False to use legacy JSON protocol
@@ -186,6 +200,100 @@ def encode_esp_bc_update(rods: list, pumps: list, humid: list) -> bytes:
     return bytes([STX, cmd, length]) + payload + bytes([crc, ETX])
 
 
+def encode_stream_command(interval_ms: int) -> bytes:
+    """
+    Encode stream control command (ESP-BC streaming telemetry)
+
+    Format: [STX][CMD_STREAM][LEN=2][interval_lo][interval_hi][CRC8][ETX]
+    Total: 7 bytes
+
+    Args:
+        interval_ms: Telemetry push interval in ms (0 = stop streaming)
+
+    Returns:
+        Binary message bytes
+    """
+    cmd = CMD_STREAM
+    interval = max(0, min(65535, int(interval_ms)))
+    payload = struct.pack('<H', interval)  # uint16 little-endian
+    length = len(payload)  # 2
+
+    # CRC over CMD + LEN + PAYLOAD
+    crc_data = bytes([cmd, length]) + payload
+    crc = crc8_maxim(crc_data)
+
+    return bytes([STX, cmd, length]) + payload + bytes([crc, ETX])
+
+
+def encode_set_baud_command(baud: int) -> bytes:
+    """
+    Encode baud switch command
+
+    Format: [STX][CMD_SET_BAUD][LEN=4][baud (uint32 LE)][CRC8][ETX]
+    Total: 9 bytes
+
+    Args:
+        baud: Requested rate (ESP validates against its allowed set)
+
+    Returns:
+        Binary message bytes
+    """
+    cmd = CMD_SET_BAUD
+    payload = struct.pack('<I', int(baud))  # uint32 little-endian
+    length = len(payload)  # 4
+
+    # CRC over CMD + LEN + PAYLOAD
+    crc_data = bytes([cmd, length]) + payload
+    crc = crc8_maxim(crc_data)
+
+    return bytes([STX, cmd, length]) + payload + bytes([crc, ETX])
+
+
+def encode_keepalive_command(cmd_generation: int) -> bytes:
+    """
+    Encode keepalive command (ESP-BC delta protocol)
+
+    Sent instead of a full update when the command state is unchanged.
+    Carries the generation number echoed in the last telemetry frame so
+    the ESP can detect a stale view (e.g. after it rebooted) and NACK.
+
+    Format: [STX][CMD_KEEPALIVE][LEN=1][generation][CRC8][ETX]
+    Total: 6 bytes (vs 15 bytes for a full update)
+
+    Args:
+        cmd_generation: Generation from the last decoded telemetry (0-255)
+
+    Returns:
+        Binary message bytes
+    """
+    cmd = CMD_KEEPALIVE
+    payload = bytes([cmd_generation & 0xFF])
+    length = len(payload)  # 1
+
+    # CRC over CMD + LEN + PAYLOAD
+    crc_data = bytes([cmd, length]) + payload
+    crc = crc8_maxim(crc_data)
+
+    return bytes([STX, cmd, length]) + payload + bytes([crc, ETX])
+
+
+def encode_stats_command() -> bytes:
+    """
+    Encode stats request (on-ESP performance counters)
+
+    Format: [STX][CMD_STATS][LEN=0][CRC8][ETX]
+    Total: 5 bytes
+
+    Returns:
+        Binary message bytes
+    """
+    cmd = CMD_STATS
+    length = 0  # No payload
+    crc_data = bytes([cmd, length])
+    crc = crc8_maxim(crc_data)
+    return bytes([STX, cmd, length, crc, ETX])
+
+
 def encode_esp_e_update(thermal_kw: float, pump_primary: int, pump_secondary: int, pump_tertiary: int) -> bytes:
     """
     Encode ESP-E update command
@@ -225,51 +333,58 @@ def encode_esp_e_update(thermal_kw: float, pump_primary: int, pump_secondary: in
 # Binary Protocol Decoders
 # ============================================
 
-def decode_binary_response(data: bytes) -> Tuple[Optional[int], Optional[int], Optional[bytes]]:
+def decode_binary_response(data: bytes, quiet: bool = False) -> Tuple[Optional[int], Optional[int], Optional[bytes]]:
     """
     Decode binary response message
-    
+
     Format: [STX][CMD][LEN][PAYLOAD...][CRC8][ETX]
-    
+
     Args:
         data: Raw bytes from serial port
-        
+        quiet: Suppress error logs (used by scan_binary_response, which
+               probes many candidate offsets and expects failures)
+
     Returns:
         Tuple of (length, msg_type, payload) or (None, None, None) if invalid
     """
     if len(data) < 5:  # Minimum: STX + CMD + LEN + CRC + ETX
-        logger.error(f"Response too short: {len(data)} bytes")
+        if not quiet:
+            logger.error(f"Response too short: {len(data)} bytes")
         return None, None, None
-    
+
     if data[0] != STX:
-        logger.error(f"Invalid STX: 0x{data[0]:02X}")
+        if not quiet:
+            logger.error(f"Invalid STX: 0x{data[0]:02X}")
         return None, None, None
-    
+
     if data[-1] != ETX:
-        logger.error(f"Invalid ETX: 0x{data[-1]:02X}")
+        if not quiet:
+            logger.error(f"Invalid ETX: 0x{data[-1]:02X}")
         return None, None, None
-    
+
     # Extract fields
     msg_type = data[1]  # CMD/ACK/NACK
     length = data[2]    # Payload length
-    
+
     # Validate message length
     expected_total_len = 5 + length  # STX + CMD + LEN + PAYLOAD + CRC + ETX
     if len(data) != expected_total_len:
-        logger.error(f"Length mismatch: got {len(data)} bytes, expected {expected_total_len} (LEN field={length})")
+        if not quiet:
+            logger.error(f"Length mismatch: got {len(data)} bytes, expected {expected_total_len} (LEN field={length})")
         return None, None, None
-    
+
     payload = data[3:3+length]  # Extract payload based on LEN field
     received_crc = data[-2]
-    
+
     # Validate CRC (over CMD + LEN + PAYLOAD)
     crc_data = data[1:3+length]  # CMD + LEN + payload
     calculated_crc = crc8_maxim(crc_data)
-    
+
     if received_crc != calculated_crc:
-        logger.error(f"CRC mismatch: received=0x{received_crc:02X}, calculated=0x{calculated_crc:02X}")
+        if not quiet:
+            logger.error(f"CRC mismatch: received=0x{received_crc:02X}, calculated=0x{calculated_crc:02X}")
         return None, None, None
-    
+
     return length, msg_type, payload
 
 
@@ -277,7 +392,7 @@ def decode_esp_bc_response(payload: bytes) -> Optional[Dict]:
     """
     Decode ESP-BC response payload
     
-    Format: [rod1][rod2][rod3][thermal_kw (4)][power_lvl (2)][state][turb_spd (2)][pump1 (2)][pump2 (2)][pump3 (2)][h1][h2][h3][h4]
+    Format: [rod1][rod2][rod3][thermal_kw (4)][power_lvl (2)][state][turb_spd (2)][pump1 (2)][pump2 (2)][pump3 (2)][h1][h2][h3][h4][gen]
     Total payload: 23 bytes
     
     Args:
@@ -306,7 +421,8 @@ def decode_esp_bc_response(payload: bytes) -> Optional[Dict]:
         h2 = payload[19]
         h3 = payload[20]
         h4 = payload[21]
-        
+        cmd_generation = payload[22]  # Echo for the delta protocol keepalive
+
         return {
             'rods': [rod1, rod2, rod3],
             'thermal_kw': thermal_kw,
@@ -314,7 +430,8 @@ def decode_esp_bc_response(payload: bytes) -> Optional[Dict]:
             'state': state,
             'turbine_speed': turb_spd,
             'pump_speeds': [pump1, pump2, pump3],
-            'humid_status': [h1, h2, h3, h4]
+            'humid_status': [h1, h2, h3, h4],
+            'cmd_generation': cmd_generation
         }
     except Exception as e:
         logger.error(f"Error decoding ESP-BC response: {e}")
@@ -357,6 +474,158 @@ def decode_esp_e_response(payload: bytes) -> Optional[Dict]:
         return None
 
 
+def decode_stats_response(payload: bytes) -> Optional[Dict]:
+    """
+    Decode EspStats payload (reply to CMD_STATS)
+
+    Format: 8 x uint32 LE - loop period min/max/mean (us), frames
+    received, CRC failures, NACKs sent, buffer overflows, actuator
+    updates (servo writes on ESP-BC, LED fades on ESP-E)
+
+    Args:
+        payload: Response payload bytes
+
+    Returns:
+        Dictionary with decoded counters or None if invalid
+    """
+    if len(payload) < 32:
+        logger.error(f"Stats payload too short: {len(payload)} bytes (expected 32)")
+        return None
+
+    try:
+        fields = struct.unpack('<8I', payload[:32])
+        return {
+            'loop_period_min_us': fields[0],
+            'loop_period_max_us': fields[1],
+            'loop_period_mean_us': fields[2],
+            'frames_received': fields[3],
+            'crc_failures': fields[4],
+            'nacks_sent': fields[5],
+            'buffer_overflows': fields[6],
+            'actuator_updates': fields[7]
+        }
+    except Exception as e:
+        logger.error(f"Error decoding stats response: {e}")
+        return None
+
+
+class BinaryFrameParser:
+    """
+    Incremental binary frame parser (mirrors the ESP-side WAIT_STX /
+    IN_FRAME state machine)
+
+    Feed it arbitrary chunks from bulk serial reads; complete
+    [STX]...[ETX] frames are returned as they materialize. The LEN field
+    determines where each frame ends, so a payload byte that happens to
+    equal ETX can't terminate a frame early. Garbage between frames and
+    runaway frames are dropped, resyncing on the next STX.
+    """
+
+    MAX_FRAME_LEN = 50  # Largest expected frame is 28 bytes
+
+    def __init__(self):
+        self._buf = bytearray()
+        self._in_frame = False
+
+    def reset(self):
+        """Drop any partial frame (e.g. after a flush or retry)"""
+        self._buf = bytearray()
+        self._in_frame = False
+
+    def feed(self, chunk: bytes) -> list:
+        """
+        Consume a chunk of received bytes
+
+        Args:
+            chunk: Raw bytes from a bulk serial read (may be empty)
+
+        Returns:
+            List of complete raw frames (bytes), possibly empty
+        """
+        frames = []
+
+        for byte in chunk:
+            if not self._in_frame:
+                if byte == STX:
+                    self._buf = bytearray([byte])
+                    self._in_frame = True
+                # Ignore garbage between frames
+            else:
+                self._buf.append(byte)
+
+                if len(self._buf) > self.MAX_FRAME_LEN:
+                    # Runaway frame - resync on next STX
+                    self.reset()
+                    continue
+
+                # Complete frame: LEN known and total length reached
+                if len(self._buf) >= 5 and len(self._buf) == 5 + self._buf[2]:
+                    if self._buf[-1] == ETX:
+                        frames.append(bytes(self._buf))
+                    # Bad trailer: drop silently, resync on next STX
+                    self.reset()
+
+        return frames
+
+
+def scan_binary_response(buffer: bytes) -> Tuple[int, Optional[int], Optional[int], Optional[bytes]]:
+    """
+    Sliding-window scan for the first fully valid frame in a receive buffer
+
+    Resynchronizing alternative to trusting the buffer to hold exactly one
+    well-formed frame: every STX candidate is probed in order, and a
+    candidate that fails validation (bad LEN, trailer or CRC) just slides
+    the scan to the next STX *within the buffered data*. A single
+    corrupted byte therefore costs a sub-millisecond rescan instead of a
+    full flush-and-retry round trip with backoff, and a good frame queued
+    behind the bad bytes is still recovered.
+
+    Args:
+        buffer: All bytes received so far this transaction (may contain
+                garbage, partial frames, or multiple frames)
+
+    Returns:
+        Tuple of (consumed, length, msg_type, payload):
+        - Valid frame found: consumed = offset just past that frame,
+          remaining fields as decode_binary_response
+        - No frame (yet): length/msg_type/payload are None and consumed
+          is the count of leading bytes that can never start a frame -
+          the caller drops them and keeps reading
+    """
+    search_from = 0
+    total_len = len(buffer)
+
+    while True:
+        idx = buffer.find(STX, search_from)
+        if idx < 0:
+            # No STX anywhere - the whole buffer is garbage
+            return total_len, None, None, None
+
+        if total_len - idx < 3:
+            # STX seen but LEN not arrived yet - keep from here
+            return idx, None, None, None
+
+        frame_len = 5 + buffer[idx + 2]
+        if frame_len > BinaryFrameParser.MAX_FRAME_LEN:
+            # Insane LEN (corrupted or mid-payload STX) - not a frame start
+            search_from = idx + 1
+            continue
+
+        if total_len - idx < frame_len:
+            # Plausible frame still arriving - keep from here, read more.
+            # If the LEN byte itself was corrupted upward, the candidate
+            # eventually completes, fails CRC and we slide past it.
+            return idx, None, None, None
+
+        candidate = bytes(buffer[idx:idx + frame_len])
+        length, msg_type, payload = decode_binary_response(candidate, quiet=True)
+        if length is not None:
+            return idx + frame_len, length, msg_type, payload
+
+        logger.debug(f"Frame candidate at offset {idx} invalid - resyncing on next STX")
+        search_from = idx + 1
+
+
 class UARTDevice:
     """Base class for UART device communication"""
     
@@ -376,6 +645,14 @@ class UARTDevice:
         self.lock = threading.Lock()
         self.error_count = 0
         self.last_comm_time = 0.0
+
+        # HotLog site keys (precomputed - no string building on hot path)
+        self._site_tx = f"uart.tx:{port}"
+        self._site_rx = f"uart.rx:{port}"
+
+        # Streaming telemetry reader (started by start_stream_reader)
+        self._stream_thread = None
+        self._stream_running = False
         
     def connect(self) -> bool:
         """
@@ -415,6 +692,29 @@ class UARTDevice:
                 logger.info(f"UART disconnected: {self.port}")
         except Exception as e:
             logger.error(f"Error closing {self.port}: {e}")
+
+    def set_baudrate(self, baudrate: int) -> bool:
+        """
+        Change the local port speed on the open connection (pyserial
+        applies it live). Used by the high-baud negotiation.
+
+        Args:
+            baudrate: New rate in baud
+
+        Returns:
+            True if applied, False otherwise
+        """
+        with self.lock:
+            try:
+                if self.serial and self.serial.is_open:
+                    self.serial.baudrate = baudrate
+                    self.serial.reset_input_buffer()
+                self.baudrate = baudrate
+                logger.info(f"UART {self.port}: local rate now {baudrate} baud")
+                return True
+            except Exception as e:
+                logger.error(f"Error changing baudrate on {self.port}: {e}")
+                return False
     
     
     def send_json(self, data: dict) -> bool:
@@ -669,85 +969,69 @@ class UARTDevice:
                     self.serial.write(command_bytes)
                     self.serial.flush()
                     
-                    # Log TX (hex dump for binary data)
-                    hex_str = ' '.join(f'{b:02X}' for b in command_bytes)
-                    logger.info(f"TX {self.port} (attempt {attempt+1}/{MAX_RETRIES}): [{hex_str}] ({len(command_bytes)} bytes)")
-                    
-                    # Wait for ESP to process and start transmitting
-                    time.sleep(0.030)  # 30ms for ESP processing
+                    # Log TX lazily - raw bytes into the ring, hex dump
+                    # happens on the HotLog drain thread
+                    hotlog.record(logging.INFO, self._site_tx,
+                                  "TX %s (attempt %d/%d): [%s] (%d bytes)",
+                                  self.port, attempt + 1, MAX_RETRIES,
+                                  command_bytes, len(command_bytes))
                     
-                    # Read response with timeout
+                    # Read response: bulk reads accumulate into a byte
+                    # window that scan_binary_response probes for the
+                    # first CRC-valid frame. A corrupted byte slides the
+                    # scan to the next STX within the window instead of
+                    # escalating to a flush + backoff retry, so a good
+                    # frame queued behind bad bytes is still recovered.
+                    # No fixed "ESP processing" sleep needed anymore - the
+                    # first read just blocks until bytes arrive.
                     old_timeout = self.serial.timeout
-                    self.serial.timeout = timeout
-                    
-                    # Read until ETX (0x03) - more robust than fixed length
-                    # This ensures we get the complete message regardless of timing
-                    response_data = b''
-                    max_bytes = 50  # Safety limit (max expected is 28 bytes)
+                    self.serial.timeout = 0.02  # Per-read block; overall deadline below
+
+                    window = bytearray()
+                    length = msg_type = payload = None
                     start_time = time.time()
-                    
-                    while len(response_data) < max_bytes:
-                        # Check timeout
-                        if time.time() - start_time > timeout:
-                            logger.warning(f"Timeout waiting for ETX from {self.port}")
+
+                    while time.time() - start_time <= timeout:
+                        # One bulk read: everything the driver buffered, or
+                        # block up to 20ms waiting for the first byte
+                        chunk = self.serial.read(max(1, self.serial.in_waiting))
+                        if not chunk:
+                            continue
+
+                        window += chunk
+                        consumed, length, msg_type, payload = scan_binary_response(window)
+                        if length is not None:
                             break
-                        
-                        # Read one byte at a time
-                        byte = self.serial.read(1)
-                        if byte:
-                            response_data += byte
-                            # Check if we got ETX (end of message)
-                            if byte[0] == ETX:
-                                break
-                        else:
-                            # No data available, wait a bit
-                            time.sleep(0.005)  # 5ms
-                    
+                        # Drop bytes that can never start a frame, keep
+                        # any partial candidate for the next read
+                        del window[:consumed]
+
                     # Restore timeout
                     self.serial.timeout = old_timeout
-                    
-                    # Validate we got a complete message
-                    if not response_data or len(response_data) < 5:
-                        logger.warning(f"No response or too short from {self.port} (got {len(response_data)} bytes)")
-                    elif response_data[-1] != ETX:
-                        logger.warning(f"Response from {self.port} does not end with ETX (got {len(response_data)} bytes)")
-                        
-                        # Flush and retry
-                        try:
-                            self.serial.reset_input_buffer()
-                        except Exception:
-                            pass
-                        
-                        if attempt < MAX_RETRIES - 1:
-                            time.sleep(RETRY_DELAYS[attempt])
-                            continue
-                        else:
-                            self.error_count += 1
-                            return None
-                    
-                    # Log RX (hex dump)
-                    hex_str_rx = ' '.join(f'{b:02X}' for b in response_data)
-                    logger.info(f"RX {self.port}: [{hex_str_rx}] ({len(response_data)} bytes)")
-                    
-                    # Decode response
-                    length, msg_type, payload = decode_binary_response(response_data)
-                    
-                    if length is None or msg_type is None:
-                        logger.error(f"Failed to decode response from {self.port}")
-                        
+
+                    # Scanner only returns CRC-valid frames, so None means
+                    # the window was exhausted (timeout or pure garbage)
+                    if length is None:
+                        logger.warning(f"No valid frame from {self.port} within {timeout}s")
+
                         # Flush and retry
                         try:
                             self.serial.reset_input_buffer()
                         except Exception:
                             pass
-                        
+
                         if attempt < MAX_RETRIES - 1:
                             time.sleep(RETRY_DELAYS[attempt])
                             continue
                         else:
                             self.error_count += 1
                             return None
-                    
+
+                    # Log RX lazily (hex dump deferred to drain thread)
+                    hotlog.record(logging.INFO, self._site_rx,
+                                  "RX %s: type=0x%02X [%s] (%d byte payload)",
+                                  self.port, msg_type, payload, length)
+
                     # Check message type
                     if msg_type == NACK:
                         logger.warning(f"Received NACK from {self.port}")
@@ -782,10 +1066,10 @@ class UARTDevice:
                     except Exception:
                         pass
                     
-                    # CRITICAL: Wait before next command to prevent collision
-                    # ESP needs time to finish transmitting response (28 bytes @ 115200 = ~2.4ms)
-                    # Add safety margin for processing
-                    time.sleep(0.030)  # 30ms inter-message delay
+                    # Short guard before the next command - the response is
+                    # already fully received (parser returns on complete
+                    # frames), this only covers ESP post-processing
+                    time.sleep(0.002)
                     
                     logger.debug(f"✓ Binary communication successful with {self.port}")
                     return length, msg_type, payload
@@ -811,6 +1095,113 @@ class UARTDevice:
             self.error_count += 1
             return None
 
+    def send_binary_nowait(self, command_bytes: bytes) -> bool:
+        """
+        Send binary command without waiting for a response (fire-and-forget)
+
+        Used in streaming mode: the ESP pushes telemetry unsolicited, so
+        commands only need to go out when setpoints change. The response
+        (short ACK) is consumed by the stream reader thread.
+
+        Args:
+            command_bytes: Binary command to send (already encoded with STX/ETX/CRC)
+
+        Returns:
+            True if the write succeeded, False otherwise
+        """
+        with self.lock:
+            try:
+                if not self.serial or not self.serial.is_open:
+                    logger.error(f"Serial port {self.port} not open")
+                    return False
+
+                self.serial.write(command_bytes)
+                self.serial.flush()
+
+                hotlog.record(logging.DEBUG, self._site_tx,
+                              "TX %s (nowait): [%s] (%d bytes)",
+                              self.port, command_bytes, len(command_bytes))
+                return True
+
+            except Exception as e:
+                logger.error(f"Error in send_binary_nowait to {self.port}: {e}")
+                self.error_count += 1
+                return False
+
+    def start_stream_reader(self, on_frame) -> bool:
+        """
+        Start background thread that consumes unsolicited stream frames
+
+        The thread runs the same STX/ETX frame state machine as the ESP side
+        and calls on_frame(length, msg_type, payload) for every valid frame.
+        Invalid frames (bad CRC/length) are dropped silently - the next
+        stream frame arrives within one interval anyway.
+
+        Args:
+            on_frame: Callback invoked with (length, msg_type, payload)
+
+        Returns:
+            True if reader started, False otherwise
+        """
+        if self._stream_thread and self._stream_thread.is_alive():
+            logger.warning(f"Stream reader already running for {self.port}")
+            return True
+
+        if not self.serial or not self.serial.is_open:
+            logger.error(f"Cannot start stream reader: {self.port} not open")
+            return False
+
+        self._stream_running = True
+        self._stream_thread = threading.Thread(
+            target=self._stream_reader_loop,
+            args=(on_frame,),
+            daemon=True,
+            name=f"StreamReader-{self.port}"
+        )
+        self._stream_thread.start()
+        logger.info(f"✅ Stream reader started for {self.port}")
+        return True
+
+    def stop_stream_reader(self):
+        """Stop the stream reader thread (if running)"""
+        self._stream_running = False
+        if self._stream_thread and self._stream_thread.is_alive():
+            self._stream_thread.join(timeout=1.0)
+        self._stream_thread = None
+        logger.info(f"Stream reader stopped for {self.port}")
+
+    def _stream_reader_loop(self, on_frame):
+        """Incremental parse of unsolicited telemetry (runs in thread)"""
+        parser = BinaryFrameParser()
+
+        while self._stream_running:
+            try:
+                if not self.serial or not self.serial.is_open:
+                    time.sleep(0.1)
+                    continue
+
+                # Short timeout read so the thread can exit promptly
+                old_timeout = self.serial.timeout
+                self.serial.timeout = 0.05
+                chunk = self.serial.read(max(1, self.serial.in_waiting))
+                self.serial.timeout = old_timeout
+
+                if not chunk:
+                    continue
+
+                for raw_frame in parser.feed(chunk):
+                    length, msg_type, payload = decode_binary_response(raw_frame)
+                    if length is not None:
+                        self.last_comm_time = time.time()
+                        try:
+                            on_frame(length, msg_type, payload)
+                        except Exception as e:
+                            logger.error(f"Stream frame callback error: {e}")
+
+            except Exception as e:
+                logger.error(f"Stream reader error on {self.port}: {e}")
+                time.sleep(0.1)
+
 
 class UARTMaster:
     """
@@ -844,6 +1235,16 @@ class UARTMaster:
         # Data storage
         self.esp_bc_data = ESP_BC_Data()
         self.esp_e_data = ESP_E_Data()
+
+        # Streaming telemetry state (enabled via enable_esp_bc_streaming)
+        self.esp_bc_streaming = False
+
+        # Delta protocol state: last full command tuple that was ACKed and
+        # the generation number the ESP echoed back. When the command is
+        # unchanged, update_esp_bc sends a 6-byte keepalive instead of
+        # the full 15-byte frame.
+        self.esp_bc_last_command = None
+        self.esp_bc_cmd_generation = 0
         
         # Connect devices
         self.esp_bc_connected = self.esp_bc.connect()
@@ -883,6 +1284,8 @@ class UARTMaster:
         
         if self.esp_bc_connected:
             logger.info(f"✅ ESP-BC: {esp_bc_port} (Control Rods + Turbine + Motor + Humid)")
+            if USE_BINARY_PROTOCOL and NEGOTIATE_HIGH_BAUD:
+                self._negotiate_high_baud(self.esp_bc, "ESP-BC")
         else:
             logger.error(f"❌ ESP-BC: {esp_bc_port} - NOT CONNECTED!")
         
@@ -921,6 +1324,8 @@ class UARTMaster:
 
                 if self.esp_e_connected:
                     logger.info(f"✅ ESP-E: {esp_e_port} (LED Visualizer)")
+                    if USE_BINARY_PROTOCOL and NEGOTIATE_HIGH_BAUD:
+                        self._negotiate_high_baud(self.esp_e, "ESP-E")
                 else:
                     logger.warning(f"⚠️  ESP-E: {esp_e_port} - NOT CONNECTED (non-critical)")
             else:
@@ -930,6 +1335,184 @@ class UARTMaster:
         
         logger.info("="*70)
     
+    def _negotiate_high_baud(self, device: UARTDevice, name: str, baud: int = HIGH_BAUD) -> bool:
+        """
+        Negotiate a higher link rate with automatic fallback
+
+        Sequence: SET_BAUD at the current rate (ACKed before the ESP
+        switches), switch the local port, confirm with a ping. If the
+        ping fails, drop back to DEFAULT_BAUD and wait out the ESP's own
+        revert window before confirming the restored link.
+
+        Args:
+            device: UARTDevice to negotiate on
+            name: Device name for logging
+            baud: Target rate
+
+        Returns:
+            True if the link is running at the target rate
+        """
+        result = device.send_receive_binary(encode_set_baud_command(baud),
+                                            expected_response_len=5, timeout=1.0)
+        if result is None:
+            logger.warning(f"⚠️  {name}: SET_BAUD not acknowledged - staying at {device.baudrate} baud")
+            return False
+
+        device.set_baudrate(baud)
+        time.sleep(0.1)  # Let the ESP re-init its UART at the new rate
+
+        ping = device.send_receive_binary(encode_ping_command(),
+                                          expected_response_len=5, timeout=1.0)
+        if ping is not None:
+            logger.info(f"✅ {name}: link negotiated to {baud} baud")
+            return True
+
+        # Post-switch ping failed (wiring can't carry the rate, or the ACK
+        # raced the switch). The ESP reverts by itself after its confirm
+        # window, so drop back and wait before re-checking the link.
+        logger.warning(f"⚠️  {name}: no response at {baud} baud - falling back to {DEFAULT_BAUD}")
+        device.set_baudrate(DEFAULT_BAUD)
+        time.sleep(BAUD_REVERT_WAIT)
+
+        ping = device.send_receive_binary(encode_ping_command(),
+                                          expected_response_len=5, timeout=1.0)
+        if ping is not None:
+            logger.info(f"✅ {name}: link restored at {DEFAULT_BAUD} baud")
+        else:
+            logger.error(f"❌ {name}: link not recovered after baud fallback")
+        return False
+
+    def enable_esp_bc_streaming(self, interval_ms: int = 50) -> bool:
+        """
+        Switch ESP-BC to streaming telemetry mode (CMD_STREAM)
+
+        The ESP pushes its 23-byte telemetry frame unsolicited at interval_ms.
+        After this, use send_esp_bc_setpoints() (fire-and-forget) instead of
+        update_esp_bc() - telemetry is consumed asynchronously by the stream
+        reader thread and is always available via get_esp_bc_data().
+
+        Args:
+            interval_ms: Telemetry push interval in ms (default 50ms = 20Hz)
+
+        Returns:
+            True if streaming is active, False otherwise
+        """
+        if not self.esp_bc_connected:
+            return False
+
+        # Enable streaming on the ESP (still in poll mode, so full handshake)
+        stream_cmd = encode_stream_command(interval_ms)
+        result = self.esp_bc.send_receive_binary(stream_cmd, expected_response_len=5, timeout=1.0)
+
+        if result is None:
+            logger.warning("ESP-BC: CMD_STREAM not acknowledged - staying in poll/ACK mode")
+            return False
+
+        length, msg_type, payload = result
+        if msg_type != ACK:
+            logger.warning("ESP-BC: CMD_STREAM rejected - staying in poll/ACK mode")
+            return False
+
+        # Start consuming unsolicited frames
+        if not self.esp_bc.start_stream_reader(self._on_esp_bc_stream_frame):
+            return False
+
+        self.esp_bc_streaming = True
+        logger.info(f"✅ ESP-BC streaming telemetry active ({interval_ms}ms interval)")
+        return True
+
+    def disable_esp_bc_streaming(self):
+        """Switch ESP-BC back to poll/ACK mode and stop the reader thread"""
+        if not self.esp_bc_streaming:
+            return
+
+        self.esp_bc_streaming = False
+
+        # Tell ESP to stop pushing (fire-and-forget; ACK drained by reader)
+        try:
+            self.esp_bc.send_binary_nowait(encode_stream_command(0))
+            time.sleep(0.1)  # Let in-flight frames drain before stopping reader
+        except Exception as e:
+            logger.warning(f"ESP-BC: Error sending stream-off: {e}")
+
+        self.esp_bc.stop_stream_reader()
+        logger.info("ESP-BC streaming telemetry disabled")
+
+    def _on_esp_bc_stream_frame(self, length: int, msg_type: int, payload: bytes):
+        """
+        Handle one unsolicited frame from ESP-BC (called from reader thread)
+
+        Telemetry frames are ACK with 23-byte payload; short ACKs (LEN=0)
+        are command acknowledgements and carry no data.
+        """
+        if msg_type != ACK or length < 23:
+            return
+
+        response_data = decode_esp_bc_response(payload)
+        if response_data is None:
+            return
+
+        # Update internal state from streamed telemetry
+        self._apply_esp_bc_response(response_data)
+
+    def _apply_esp_bc_response(self, response_data: Dict):
+        """Copy a decoded ESP-BC telemetry dict into esp_bc_data"""
+        self.esp_bc_data.safety_actual = response_data['rods'][0]
+        self.esp_bc_data.shim_actual = response_data['rods'][1]
+        self.esp_bc_data.regulating_actual = response_data['rods'][2]
+
+        self.esp_bc_data.kw_thermal = response_data['thermal_kw']
+        self.esp_bc_data.power_level = response_data['power_level']
+        self.esp_bc_data.state = response_data['state']
+        self.esp_bc_data.turbine_speed = response_data['turbine_speed']
+
+        self.esp_bc_data.pump_primary_speed = response_data['pump_speeds'][0]
+        self.esp_bc_data.pump_secondary_speed = response_data['pump_speeds'][1]
+        self.esp_bc_data.pump_tertiary_speed = response_data['pump_speeds'][2]
+
+        self.esp_bc_data.humid_ct1_status = response_data['humid_status'][0]
+        self.esp_bc_data.humid_ct2_status = response_data['humid_status'][1]
+        self.esp_bc_data.humid_ct3_status = response_data['humid_status'][2]
+        self.esp_bc_data.humid_ct4_status = response_data['humid_status'][3]
+
+        # Track the ESP's generation echo for delta-protocol keepalives
+        self.esp_bc_cmd_generation = response_data.get('cmd_generation', 0)
+
+    def send_esp_bc_setpoints(self, safety: int, shim: int, regulating: int,
+                              pump_primary: int = 0, pump_secondary: int = 0, pump_tertiary: int = 0,
+                              humid_ct1: int = 0, humid_ct2: int = 0,
+                              humid_ct3: int = 0, humid_ct4: int = 0) -> bool:
+        """
+        Send setpoints to ESP-BC without waiting for a response (streaming mode)
+
+        Only call this when setpoints actually changed - the ESP keeps acting
+        on the last received values, and telemetry comes back via the stream.
+
+        Args: same as update_esp_bc()
+
+        Returns:
+            True if the command was written, False otherwise
+        """
+        if not self.esp_bc_connected:
+            return False
+
+        # Update internal state
+        self.esp_bc_data.safety_target = safety
+        self.esp_bc_data.shim_target = shim
+        self.esp_bc_data.regulating_target = regulating
+        self.esp_bc_data.humid_ct1_cmd = humid_ct1
+        self.esp_bc_data.humid_ct2_cmd = humid_ct2
+        self.esp_bc_data.humid_ct3_cmd = humid_ct3
+        self.esp_bc_data.humid_ct4_cmd = humid_ct4
+
+        command_bytes = encode_esp_bc_update(
+            rods=[safety, shim, regulating],
+            pumps=[pump_primary, pump_secondary, pump_tertiary],
+            humid=[humid_ct1, humid_ct2, humid_ct3, humid_ct4]
+        )
+
+        return self.esp_bc.send_binary_nowait(command_bytes)
+
     def update_esp_bc(self, safety: int, shim: int, regulating: int,
                       pump_primary: int = 0, pump_secondary: int = 0, pump_tertiary: int = 0,
                       humid_ct1: int = 0, humid_ct2: int = 0,
@@ -963,51 +1546,66 @@ class UARTMaster:
         
         if USE_BINARY_PROTOCOL:
             # === BINARY PROTOCOL ===
+            command_tuple = (safety, shim, regulating,
+                             pump_primary, pump_secondary, pump_tertiary,
+                             humid_ct1, humid_ct2, humid_ct3, humid_ct4)
+
+            if command_tuple == self.esp_bc_last_command:
+                # Delta protocol: command unchanged (the usual case) - poll
+                # with a 6-byte keepalive instead of the full 15-byte frame.
+                # The ESP answers with a short ACK unless its telemetry
+                # crossed a reporting threshold since the last full frame.
+                keepalive = encode_keepalive_command(self.esp_bc_cmd_generation)
+                result = self.esp_bc.send_receive_binary(keepalive, expected_response_len=28, timeout=1.5)
+
+                if result is not None:
+                    length, msg_type, payload = result
+
+                    if length == 0:
+                        # "No change" ACK - cached telemetry still valid
+                        return True
+
+                    response_data = decode_esp_bc_response(payload)
+                    if response_data is not None:
+                        self._apply_esp_bc_response(response_data)
+                        return True
+
+                # NACKed (generation mismatch, e.g. ESP rebooted) or failed:
+                # fall through and resend the full command to resync
+                logger.info("ESP-BC: Keepalive rejected - resending full command")
+                self.esp_bc_last_command = None
+
             # Encode binary command
             command_bytes = encode_esp_bc_update(
                 rods=[safety, shim, regulating],
                 pumps=[pump_primary, pump_secondary, pump_tertiary],
                 humid=[humid_ct1, humid_ct2, humid_ct3, humid_ct4]
             )
-            
+
             # Expected response: [STX][ACK][LEN=23][23 bytes payload][CRC][ETX] = 28 bytes
             expected_len = 28
-            
+
             # Send and receive with retry
             result = self.esp_bc.send_receive_binary(command_bytes, expected_len, timeout=1.5)
-            
+
             if result is None:
                 logger.warning("ESP-BC: Binary communication failed")
                 return False
-            
+
             length, msg_type, payload = result
-            
+
             # Decode response
             response_data = decode_esp_bc_response(payload)
-            
+
             if response_data is None:
                 logger.error("ESP-BC: Failed to decode binary response")
                 return False
-            
-            # Update internal state from response
-            self.esp_bc_data.safety_actual = response_data['rods'][0]
-            self.esp_bc_data.shim_actual = response_data['rods'][1]
-            self.esp_bc_data.regulating_actual = response_data['rods'][2]
-            
-            self.esp_bc_data.kw_thermal = response_data['thermal_kw']
-            self.esp_bc_data.power_level = response_data['power_level']
-            self.esp_bc_data.state = response_data['state']
-            self.esp_bc_data.turbine_speed = response_data['turbine_speed']
-            
-            self.esp_bc_data.pump_primary_speed = response_data['pump_speeds'][0]
-            self.esp_bc_data.pump_secondary_speed = response_data['pump_speeds'][1]
-            self.esp_bc_data.pump_tertiary_speed = response_data['pump_speeds'][2]
-            
-            self.esp_bc_data.humid_ct1_status = response_data['humid_status'][0]
-            self.esp_bc_data.humid_ct2_status = response_data['humid_status'][1]
-            self.esp_bc_data.humid_ct3_status = response_data['humid_status'][2]
-            self.esp_bc_data.humid_ct4_status = response_data['humid_status'][3]
-            
+
+            # Update internal state from response (also records the ESP's
+            # generation echo used by subsequent keepalives)
+            self._apply_esp_bc_response(response_data)
+            self.esp_bc_last_command = command_tuple
+
             logger.debug(f"ESP-BC: Rods={response_data['rods']}, "
                         f"Thermal={self.esp_bc_data.kw_thermal:.1f}kW, "
                         f"Pumps=[{self.esp_bc_data.pump_primary_speed:.1f}%, "
@@ -1150,14 +1748,62 @@ class UARTMaster:
         """Get latest data from ESP-E"""
         return self.esp_e_data
     
+    def get_esp_stats(self, esp_name: str) -> Optional[Dict]:
+        """
+        Read on-ESP performance counters via CMD_STATS
+
+        Returns loop period min/max/mean (us), frames received, CRC
+        failures, NACKs sent, buffer overflows and actuator updates -
+        the ESP's own view of the link and its control loop, reachable
+        without the USB debug serial.
+
+        Args:
+            esp_name: 'esp_bc' or 'esp_e'
+
+        Returns:
+            Dictionary of counters or None if unavailable
+        """
+        if esp_name == 'esp_bc':
+            if not self.esp_bc_connected:
+                return None
+            if self.esp_bc_streaming:
+                # Stream reader owns the RX path - a poll transaction here
+                # would race it for the response frame
+                logger.debug("ESP-BC stats skipped (streaming mode)")
+                return None
+            device = self.esp_bc
+        elif esp_name == 'esp_e':
+            if not (self.esp_e_enabled and self.esp_e_connected):
+                return None
+            device = self.esp_e
+        else:
+            logger.error(f"Unknown ESP name for stats: {esp_name}")
+            return None
+
+        # Stats response: [STX][ACK][LEN=32][EspStats][CRC][ETX] = 37 bytes
+        result = device.send_receive_binary(encode_stats_command(),
+                                            expected_response_len=37, timeout=1.0)
+        if result is None:
+            return None
+
+        length, msg_type, payload = result
+        if msg_type != ACK or length != 32:
+            logger.warning(f"{esp_name}: unexpected stats response (type=0x{msg_type:02X}, len={length})")
+            return None
+
+        return decode_stats_response(payload)
+
     def get_health_status(self) -> Dict:
         """
         Get health status of both ESP devices
-        
+
+        Includes the on-ESP performance counters (CMD_STATS) when the
+        link allows a poll transaction, under the 'stats' key.
+
         Returns:
             Dictionary with health information
         """
-        return {
+        health = {
             'esp_bc': {
                 'connected': self.esp_bc_connected,
                 'port': self.esp_bc.port,
@@ -1173,11 +1819,28 @@ class UARTMaster:
                 'status': 'OK' if self.esp_e.error_count < 5 else 'WARNING'
             }
         }
+
+        # On-ESP counters (best-effort - old firmware NACKs CMD_STATS)
+        for esp_name in ('esp_bc', 'esp_e'):
+            try:
+                stats = self.get_esp_stats(esp_name)
+                if stats is not None:
+                    health[esp_name]['stats'] = stats
+            except Exception as e:
+                logger.debug(f"{esp_name} stats unavailable: {e}")
+
+        return health
     
     def close(self):
         """Close all UART connections"""
         logger.info("Closing UART connections...")
-        
+
+        # Stop streaming first so safe state uses the poll/ACK path
+        try:
+            self.disable_esp_bc_streaming()
+        except Exception:
+            pass
+
         # Send safe state before closing
         try:
             if self.esp_bc_connected:
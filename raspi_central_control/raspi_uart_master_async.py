@@ -0,0 +1,445 @@
+"""
+Async Pipelined UART Master (serial_asyncio variant)
+
+Drop-in async counterpart of raspi_uart_master.UARTMaster. Instead of one
+blocking thread per port (write, sleep, read, retry all serialized), both
+serial ports are multiplexed on a single asyncio event loop:
+
+- Commands are queued as transactions with a Future for the response
+- Received bytes are fed to the shared BinaryFrameParser; complete frames
+  resolve the pending Future (or go to the unsolicited/stream callback)
+- Retries are scheduled with asyncio.sleep - no thread ever blocks
+- Every transaction takes its own deadline instead of a global timeout,
+  so a slow display link can run with a looser budget than the control
+  link without holding anything up
+
+Reuses the binary protocol codec (encode_*/decode_*, CRC8, frame parser)
+from raspi_uart_master - the wire format is identical, only the I/O
+engine differs. Requires pyserial-asyncio (optional dependency):
+
+    pip install pyserial-asyncio
+
+Example:
+
+    async def main():
+        master = AsyncUARTMaster()
+        await master.connect()
+        ok = await master.update_esp_bc(safety=50, shim=60, regulating=70)
+        await master.close()
+"""
+
+import asyncio
+import logging
+import time
+from typing import Optional, Tuple
+
+try:
+    import serial_asyncio
+    SERIAL_ASYNCIO_AVAILABLE = True
+except ImportError:
+    SERIAL_ASYNCIO_AVAILABLE = False
+
+from raspi_uart_master import (
+    ACK, NACK,
+    MAX_RETRIES, RETRY_DELAYS,
+    DEFAULT_BAUD,
+    BinaryFrameParser,
+    ESP_BC_Data, ESP_E_Data,
+    encode_ping_command, encode_esp_bc_update, encode_esp_e_update,
+    encode_keepalive_command,
+    decode_binary_response, decode_esp_bc_response, decode_esp_e_response,
+)
+from raspi_hotlog import hotlog
+
+logger = logging.getLogger(__name__)
+
+# Per-command deadlines (seconds). The control link gets a tight budget;
+# the display link can afford to be slower without delaying anything.
+DEADLINE_PING = 0.5
+DEADLINE_ESP_BC = 0.25
+DEADLINE_ESP_E = 0.5
+
+
+class _FrameProtocol(asyncio.Protocol):
+    """Feeds received bytes to the incremental parser, emits whole frames"""
+
+    def __init__(self, on_frame, on_lost):
+        self._parser = BinaryFrameParser()
+        self._on_frame = on_frame
+        self._on_lost = on_lost
+        self.transport = None
+
+    def connection_made(self, transport):
+        self.transport = transport
+
+    def data_received(self, data):
+        for frame in self._parser.feed(data):
+            self._on_frame(frame)
+
+    def connection_lost(self, exc):
+        self._on_lost(exc)
+
+
+class AsyncUARTDevice:
+    """
+    One serial port on the shared event loop
+
+    Transactions are pipelined through an asyncio.Lock (one in flight per
+    port - the ESPs answer strictly in order) with the response delivered
+    via a Future the RX path resolves as soon as the frame completes.
+    """
+
+    def __init__(self, port: str, baudrate: int = DEFAULT_BAUD):
+        self.port = port
+        self.baudrate = baudrate
+        self.transport = None
+        self.protocol = None
+        self.error_count = 0
+        self.last_comm_time = 0.0
+
+        self._tx_lock = asyncio.Lock()
+        self._response_future: Optional[asyncio.Future] = None
+        self.on_unsolicited = None  # Callback for stream frames (length, msg_type, payload)
+
+    @property
+    def connected(self) -> bool:
+        return self.transport is not None
+
+    async def connect(self) -> bool:
+        """Open the port (no flush-sleep sequences - the parser discards
+        any boot garbage by hunting for STX)"""
+        if not SERIAL_ASYNCIO_AVAILABLE:
+            logger.error("pyserial-asyncio not installed - async UART unavailable")
+            return False
+
+        try:
+            loop = asyncio.get_running_loop()
+            self.transport, self.protocol = await serial_asyncio.create_serial_connection(
+                loop,
+                lambda: _FrameProtocol(self._handle_frame, self._handle_lost),
+                self.port,
+                baudrate=self.baudrate
+            )
+            logger.info(f"✅ UART connected (async): {self.port} at {self.baudrate} baud")
+            return True
+        except Exception as e:
+            logger.error(f"❌ Failed to open {self.port}: {e}")
+            self.transport = None
+            return False
+
+    def disconnect(self):
+        if self.transport:
+            self.transport.close()
+            self.transport = None
+            logger.info(f"UART disconnected: {self.port}")
+
+    def _handle_frame(self, raw_frame: bytes):
+        """RX path (event loop context): resolve the pending transaction,
+        or hand unsolicited frames (streaming telemetry) to the callback"""
+        length, msg_type, payload = decode_binary_response(raw_frame)
+        if length is None or msg_type is None:
+            return
+
+        self.last_comm_time = time.time()
+
+        future = self._response_future
+        if future is not None and not future.done():
+            future.set_result((length, msg_type, payload))
+        elif self.on_unsolicited is not None:
+            try:
+                self.on_unsolicited(length, msg_type, payload)
+            except Exception as e:
+                logger.error(f"Unsolicited frame callback error: {e}")
+
+    def _handle_lost(self, exc):
+        if exc is not None:
+            logger.error(f"UART connection lost on {self.port}: {exc}")
+        self.transport = None
+        future = self._response_future
+        if future is not None and not future.done():
+            future.cancel()
+
+    def send_nowait(self, command_bytes: bytes) -> bool:
+        """Fire-and-forget write (streaming-mode setpoints)"""
+        if not self.transport:
+            return False
+        self.transport.write(command_bytes)
+        return True
+
+    async def transact(self, command_bytes: bytes, deadline: float = 1.0,
+                       retries: int = MAX_RETRIES) -> Optional[Tuple[int, int, bytes]]:
+        """
+        Send a command and await its response
+
+        Args:
+            command_bytes: Encoded frame (STX..ETX)
+            deadline: Per-attempt response deadline in seconds
+            retries: Attempts before giving up (NACK or timeout)
+
+        Returns:
+            Tuple of (length, msg_type, payload) on ACK, None otherwise
+        """
+        if not self.transport:
+            logger.error(f"Serial port {self.port} not open")
+            return None
+
+        async with self._tx_lock:
+            loop = asyncio.get_running_loop()
+
+            for attempt in range(retries):
+                self._response_future = loop.create_future()
+                try:
+                    self.transport.write(command_bytes)
+
+                    hotlog.record(logging.DEBUG, f"uart.tx:{self.port}",
+                                  "TX %s (attempt %d/%d): [%s]",
+                                  self.port, attempt + 1, retries, command_bytes)
+
+                    try:
+                        result = await asyncio.wait_for(self._response_future, deadline)
+                    except asyncio.TimeoutError:
+                        logger.warning(f"Deadline ({deadline}s) passed waiting on {self.port}")
+                        result = None
+                    except asyncio.CancelledError:
+                        return None
+                finally:
+                    self._response_future = None
+
+                if result is not None:
+                    length, msg_type, payload = result
+                    if msg_type == ACK:
+                        if self.error_count > 0:
+                            logger.info(f"Communication restored with {self.port}")
+                            self.error_count = 0
+                        return result
+                    if msg_type == NACK:
+                        logger.warning(f"Received NACK from {self.port}")
+                    else:
+                        logger.error(f"Unexpected message type: 0x{msg_type:02X}")
+
+                # Retry backoff without blocking the loop
+                if attempt < retries - 1:
+                    await asyncio.sleep(RETRY_DELAYS[min(attempt, len(RETRY_DELAYS) - 1)])
+
+            logger.error(f"All {retries} attempts failed for {self.port}")
+            self.error_count += 1
+            return None
+
+
+class AsyncUARTMaster:
+    """
+    Async UART master: both ESP links multiplexed on one event loop
+
+    Mirrors the UARTMaster API with awaitable methods. The delta protocol
+    (keepalive + generation echo) works the same as in the sync master.
+    """
+
+    def __init__(self, esp_bc_port: str = '/dev/ttyAMA0',
+                 esp_e_port: str = '/dev/ttyAMA3',
+                 baudrate: int = DEFAULT_BAUD):
+        self.esp_bc = AsyncUARTDevice(esp_bc_port, baudrate)
+        self.esp_e = AsyncUARTDevice(esp_e_port, baudrate) if esp_e_port else None
+        self.esp_e_enabled = esp_e_port is not None
+
+        self.esp_bc_connected = False
+        self.esp_e_connected = False
+
+        self.esp_bc_data = ESP_BC_Data()
+        self.esp_e_data = ESP_E_Data()
+
+        # Delta protocol state (see update_esp_bc)
+        self.esp_bc_last_command = None
+        self.esp_bc_cmd_generation = 0
+
+    async def connect(self) -> bool:
+        """Open and handshake both ports concurrently (no serial startup
+        cost: the two pings overlap on the loop)"""
+        logger.info("=" * 70)
+        logger.info("Async UART Master Initialization")
+        logger.info("=" * 70)
+
+        opens = [self.esp_bc.connect()]
+        if self.esp_e_enabled:
+            opens.append(self.esp_e.connect())
+        results = await asyncio.gather(*opens)
+
+        handshakes = []
+        if results[0]:
+            handshakes.append(self._handshake(self.esp_bc, "ESP-BC"))
+        if self.esp_e_enabled and results[-1]:
+            handshakes.append(self._handshake(self.esp_e, "ESP-E"))
+        pongs = await asyncio.gather(*handshakes) if handshakes else []
+
+        idx = 0
+        if results[0]:
+            self.esp_bc_connected = pongs[idx]
+            idx += 1
+        if self.esp_e_enabled and results[-1]:
+            self.esp_e_connected = pongs[idx]
+
+        logger.info(f"ESP-BC: {'✅ connected' if self.esp_bc_connected else '❌ not connected'}")
+        if self.esp_e_enabled:
+            logger.info(f"ESP-E: {'✅ connected' if self.esp_e_connected else '⚠️  not connected (non-critical)'}")
+        return self.esp_bc_connected
+
+    async def _handshake(self, device: AsyncUARTDevice, name: str) -> bool:
+        result = await device.transact(encode_ping_command(), deadline=DEADLINE_PING)
+        if result is not None:
+            logger.info(f"✅ {name} handshake successful (binary pong)")
+            return True
+        logger.warning(f"⚠️  {name} did not respond to binary ping")
+        return False
+
+    def _apply_esp_bc_response(self, response_data: dict):
+        """Copy a decoded ESP-BC telemetry dict into esp_bc_data"""
+        self.esp_bc_data.safety_actual = response_data['rods'][0]
+        self.esp_bc_data.shim_actual = response_data['rods'][1]
+        self.esp_bc_data.regulating_actual = response_data['rods'][2]
+
+        self.esp_bc_data.kw_thermal = response_data['thermal_kw']
+        self.esp_bc_data.power_level = response_data['power_level']
+        self.esp_bc_data.state = response_data['state']
+        self.esp_bc_data.turbine_speed = response_data['turbine_speed']
+
+        self.esp_bc_data.pump_primary_speed = response_data['pump_speeds'][0]
+        self.esp_bc_data.pump_secondary_speed = response_data['pump_speeds'][1]
+        self.esp_bc_data.pump_tertiary_speed = response_data['pump_speeds'][2]
+
+        self.esp_bc_data.humid_ct1_status = response_data['humid_status'][0]
+        self.esp_bc_data.humid_ct2_status = response_data['humid_status'][1]
+        self.esp_bc_data.humid_ct3_status = response_data['humid_status'][2]
+        self.esp_bc_data.humid_ct4_status = response_data['humid_status'][3]
+
+        self.esp_bc_cmd_generation = response_data.get('cmd_generation', 0)
+
+    async def update_esp_bc(self, safety: int, shim: int, regulating: int,
+                            pump_primary: int = 0, pump_secondary: int = 0, pump_tertiary: int = 0,
+                            humid_ct1: int = 0, humid_ct2: int = 0,
+                            humid_ct3: int = 0, humid_ct4: int = 0) -> bool:
+        """Send update (or delta keepalive) to ESP-BC, await telemetry"""
+        if not self.esp_bc_connected:
+            return False
+
+        self.esp_bc_data.safety_target = safety
+        self.esp_bc_data.shim_target = shim
+        self.esp_bc_data.regulating_target = regulating
+        self.esp_bc_data.humid_ct1_cmd = humid_ct1
+        self.esp_bc_data.humid_ct2_cmd = humid_ct2
+        self.esp_bc_data.humid_ct3_cmd = humid_ct3
+        self.esp_bc_data.humid_ct4_cmd = humid_ct4
+
+        command_tuple = (safety, shim, regulating,
+                         pump_primary, pump_secondary, pump_tertiary,
+                         humid_ct1, humid_ct2, humid_ct3, humid_ct4)
+
+        if command_tuple == self.esp_bc_last_command:
+            # Delta protocol: unchanged command - 6-byte keepalive
+            keepalive = encode_keepalive_command(self.esp_bc_cmd_generation)
+            result = await self.esp_bc.transact(keepalive, deadline=DEADLINE_ESP_BC)
+
+            if result is not None:
+                length, msg_type, payload = result
+                if length == 0:
+                    return True  # "No change" ACK - cached telemetry valid
+                response_data = decode_esp_bc_response(payload)
+                if response_data is not None:
+                    self._apply_esp_bc_response(response_data)
+                    return True
+
+            logger.info("ESP-BC: Keepalive rejected - resending full command")
+            self.esp_bc_last_command = None
+
+        command_bytes = encode_esp_bc_update(
+            rods=[safety, shim, regulating],
+            pumps=[pump_primary, pump_secondary, pump_tertiary],
+            humid=[humid_ct1, humid_ct2, humid_ct3, humid_ct4]
+        )
+
+        result = await self.esp_bc.transact(command_bytes, deadline=DEADLINE_ESP_BC)
+        if result is None:
+            logger.warning("ESP-BC: Binary communication failed")
+            return False
+
+        length, msg_type, payload = result
+        response_data = decode_esp_bc_response(payload)
+        if response_data is None:
+            logger.error("ESP-BC: Failed to decode binary response")
+            return False
+
+        self._apply_esp_bc_response(response_data)
+        self.esp_bc_last_command = command_tuple
+        return True
+
+    async def update_esp_e(self, thermal_power_kw: float = 0.0,
+                           pump_primary_status: int = 0,
+                           pump_secondary_status: int = 0,
+                           pump_tertiary_status: int = 0) -> bool:
+        """Send update to ESP-E, await its short response"""
+        if not self.esp_e_connected or self.esp_e is None:
+            return False
+
+        command_bytes = encode_esp_e_update(
+            thermal_kw=thermal_power_kw,
+            pump_primary=pump_primary_status,
+            pump_secondary=pump_secondary_status,
+            pump_tertiary=pump_tertiary_status
+        )
+
+        result = await self.esp_e.transact(command_bytes, deadline=DEADLINE_ESP_E)
+        if result is None:
+            return False
+
+        length, msg_type, payload = result
+        response_data = decode_esp_e_response(payload)
+        if response_data is None:
+            return False
+
+        self.esp_e_data.power_mwe = response_data['power_mwe']
+        self.esp_e_data.pwm = response_data['pwm']
+        return True
+
+    def get_esp_bc_data(self) -> ESP_BC_Data:
+        return self.esp_bc_data
+
+    def get_esp_e_data(self) -> ESP_E_Data:
+        return self.esp_e_data
+
+    async def close(self):
+        """Close both connections"""
+        self.esp_bc.disconnect()
+        if self.esp_e_enabled and self.esp_e is not None:
+            self.esp_e.disconnect()
+        logger.info("✅ Async UART Master closed")
+
+
+# Test function
+if __name__ == "__main__":
+    logging.basicConfig(level=logging.DEBUG)
+
+    async def main():
+        print("\n" + "=" * 70)
+        print("Testing Async UART Master - ESP-BC Only")
+        print("=" * 70)
+
+        master = AsyncUARTMaster(esp_bc_port='/dev/ttyAMA0', esp_e_port=None)
+        if not await master.connect():
+            print("  ❌ ESP-BC not reachable")
+            return
+
+        success = await master.update_esp_bc(
+            safety=50, shim=60, regulating=70,
+            pump_primary=2, pump_secondary=2, pump_tertiary=1,
+            humid_ct1=1, humid_ct2=0, humid_ct3=1, humid_ct4=0
+        )
+
+        if success:
+            data = master.get_esp_bc_data()
+            print(f"  ✅ Rod positions: {data.safety_actual}, {data.shim_actual}, {data.regulating_actual}")
+            print(f"  ✅ Thermal power: {data.kw_thermal} kW")
+        else:
+            print("  ❌ Failed to communicate with ESP-BC")
+
+        await master.close()
+        print("\n✅ Test complete")
+
+    asyncio.run(main())